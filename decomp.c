@@ -0,0 +1,373 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils.h"
+#include "decomp.h"
+
+//Points of block r when n points are split over p processes
+int block_size ( int n, int p, int r )
+{
+    return n / p + ( r < n % p );
+}
+
+//Global index of the first point of block r
+int block_start ( int n, int p, int r )
+{
+    return r * ( n / p ) + ( ( r < n % p ) ? r : n % p );
+}
+
+//Every process of the Cartesian communicator comm holds its block in the
+//interior of u, with ghost layers, and rank 0 collects them into the global
+//grid U (ghost 0) in one MPI_Alltoallw in which only rank 0 receives, with a
+//subarray datatype per block: every block is moved exactly, whatever its size
+//The offsets are in the datatypes and every displacement is 0, like the
+//remaps of the sine skeleton
+static void collect ( int ndims, double * U, int * gsizes, double * u, int * lsizes, int * lsub, int ghost, const int * global, MPI_Comm comm )
+{
+    int q, d, rank, size, dims[3], periods[3], coords[3], sub[3], start[3];
+    int * counts[2], * displs;
+    MPI_Datatype * types[2];
+
+    MPI_Comm_rank ( comm, &rank );
+    MPI_Comm_size ( comm, &size );
+    MPI_Cart_get ( comm, ndims, dims, periods, coords );
+    displs = ( int * ) calloc ( size, sizeof ( int ) );
+    for ( d = 0; d < 2; d++ )
+        {
+            counts[d] = ( int * ) calloc ( size, sizeof ( int ) );
+            types[d] = ( MPI_Datatype * ) malloc ( size * sizeof ( MPI_Datatype ) );
+            for ( q = 0; q < size; q++ )
+                types[d][q] = MPI_DOUBLE;
+        }
+
+    //counts[0]/types[0]: the global side, on rank 0 only; counts[1]/types[1]: the block
+    if ( rank == 0 )
+        for ( q = 0; q < size; q++ )
+            {
+                MPI_Cart_coords ( comm, q, ndims, coords );
+                for ( d = 0; d < ndims; d++ )
+                    {
+                        sub[d] = block_size ( global[d], dims[d], coords[d] );
+                        start[d] = block_start ( global[d], dims[d], coords[d] );
+                    }
+                MPI_Type_create_subarray ( ndims, gsizes, sub, start, MPI_ORDER_C, MPI_DOUBLE, &types[0][q] );
+                MPI_Type_commit ( &types[0][q] );
+                counts[0][q] = 1;
+            }
+    for ( d = 0; d < ndims; d++ )
+        start[d] = ghost;
+    MPI_Type_create_subarray ( ndims, lsizes, lsub, start, MPI_ORDER_C, MPI_DOUBLE, &types[1][0] );
+    MPI_Type_commit ( &types[1][0] );
+    counts[1][0] = 1;
+
+    MPI_Alltoallw ( u, counts[1], displs, types[1], U, counts[0], displs, types[0], comm );
+
+    for ( d = 0; d < 2; d++ )
+        {
+            for ( q = 0; q < size; q++ )
+                if ( counts[d][q] )
+                    MPI_Type_free ( &types[d][q] );
+            free ( counts[d] );
+            free ( types[d] );
+        }
+    free ( displs );
+}
+
+//U is only written on rank 0, where it must hold the global X x Y grid
+void gather2d ( grid2d * U, grid2d * u, const int * global, MPI_Comm comm )
+{
+    int gsizes[2] = {global[0], 0}, lsizes[2] = {u->dimX, u->stride}, lsub[2] = {u->X, u->Y};
+    if ( U != NULL )
+        gsizes[1] = U->stride;
+    collect ( 2, U ? U->data : NULL, gsizes, u->data, lsizes, lsub, u->ghost, global, comm );
+}
+
+void gather3d ( grid3d * U, grid3d * u, const int * global, MPI_Comm comm )
+{
+    int gsizes[3] = {global[0], global[1], 0}, lsizes[3] = {u->dimX, u->dimY, u->stride}, lsub[3] = {u->X, u->Y, u->Z};
+    if ( U != NULL )
+        gsizes[2] = U->stride;
+    collect ( 3, U ? U->data : NULL, gsizes, u->data, lsizes, lsub, u->ghost, global, comm );
+}
+
+//Rebalance the blocks from time, the time this process took for its block
+//since the last call: the blocks of one coordinate advance at the pace of
+//their slowest process, so along every dimension a coordinate gets a share
+//of the points proportional to the points it had over that time
+//Nothing moves unless the slowest process took more than 1 + tol times the
+//average, and no block gets fewer than min points. local and offset become
+//those of the new block; returns whether any block changed, on every process
+int balance_blocks ( double time, int ndims, const int * global, int * local, int * offset, int min, double tol, MPI_Comm comm )
+{
+    int q, d, c, size, moved = 0, dims[3], periods[3], coords[3], qc[3], * old, * share;
+    double mine[4], * all, * slow, total = 0, slowest = 0, fastest = -1, sum;
+
+    MPI_Comm_size ( comm, &size );
+    MPI_Cart_get ( comm, ndims, dims, periods, coords );
+    all = ( double * ) malloc ( size * ( ndims + 1 ) * sizeof ( double ) );
+    mine[0] = time;
+    for ( d = 0; d < ndims; d++ )
+        mine[d + 1] = local[d];
+    MPI_Allgather ( mine, ndims + 1, MPI_DOUBLE, all, ndims + 1, MPI_DOUBLE, comm );
+    for ( q = 0; q < size; q++ )
+        {
+            total += all[q * ( ndims + 1 )];
+            slowest = max ( slowest, all[q * ( ndims + 1 )] );
+            fastest = ( fastest < 0 || all[q * ( ndims + 1 )] < fastest ) ? all[q * ( ndims + 1 )] : fastest;
+        }
+    if ( fastest <= 0 || slowest <= ( 1 + tol ) * total / size )
+        {
+            free ( all );
+            return 0;
+        }
+
+    for ( d = 0; d < ndims; d++ )
+        {
+            if ( global[d] < min * dims[d] )
+                continue;
+            slow = ( double * ) calloc ( dims[d], sizeof ( double ) );
+            old = ( int * ) malloc ( dims[d] * sizeof ( int ) );
+            share = ( int * ) malloc ( dims[d] * sizeof ( int ) );
+            for ( q = 0; q < size; q++ )
+                {
+                    MPI_Cart_coords ( comm, q, ndims, qc );
+                    slow[qc[d]] = max ( slow[qc[d]], all[q * ( ndims + 1 )] );
+                    old[qc[d]] = ( int ) all[q * ( ndims + 1 ) + d + 1];
+                }
+            //slow becomes the target share, halfway from the old one so that a
+            //noisy measurement moves little, rounded down, then the points left
+            //go to the coordinates furthest below their target
+            sum = 0;
+            for ( c = 0; c < dims[d]; c++ )
+                sum += old[c] / slow[c];
+            q = global[d];
+            for ( c = 0; c < dims[d]; c++ )
+                {
+                    slow[c] = 0.5 * ( old[c] + global[d] * ( old[c] / slow[c] ) / sum );
+                    share[c] = ( int ) slow[c];
+                    q -= share[c];
+                }
+            for ( ; q > 0; q-- )
+                {
+                    int best = 0;
+                    for ( c = 1; c < dims[d]; c++ )
+                        if ( slow[c] - share[c] > slow[best] - share[best] )
+                            best = c;
+                    share[best]++;
+                }
+            //Blocks below min take points from the largest one
+            for ( c = 0; c < dims[d]; c++ )
+                while ( share[c] < min )
+                    {
+                        int big = 0;
+                        for ( q = 1; q < dims[d]; q++ )
+                            if ( share[q] > share[big] )
+                                big = q;
+                        share[big]--;
+                        share[c]++;
+                    }
+            offset[d] = 0;
+            for ( c = 0; c < dims[d]; c++ )
+                {
+                    moved |= ( share[c] != old[c] );
+                    if ( c < coords[d] )
+                        offset[d] += share[c];
+                }
+            local[d] = share[coords[d]];
+            free ( slow );
+            free ( old );
+            free ( share );
+        }
+    free ( all );
+    return moved;
+}
+
+//Intersection [lo, hi) of the blocks a and b, given as first index and size
+//along each of the 2 dimensions ({first0, first1, size0, size1})
+static int intersect ( const int * a, const int * b, int * lo, int * hi )
+{
+    int d;
+    for ( d = 0; d < 2; d++ )
+        {
+            lo[d] = ( a[d] > b[d] ) ? a[d] : b[d];
+            hi[d] = ( a[d] + a[d + 2] < b[d] + b[d + 2] ) ? a[d] + a[d + 2] : b[d] + b[d + 2];
+            if ( hi[d] <= lo[d] )
+                return 0;
+        }
+    return 1;
+}
+
+//Move the interior of u, the block from global indices from[0], from[1], into
+//v, the block of this process from to[0], to[1] after the decomposition changed
+//Every process sends each one the part of its old block that is in the new
+//block of that one, a subarray, in one MPI_Alltoallw: after a shift of the
+//block boundaries, only the strips that changed owner go to the neighbours
+void redistribute2d ( grid2d * u, const int * from, grid2d * v, const int * to, MPI_Comm comm )
+{
+    int q, d, size, mine[8] = {from[0], from[1], u->X, u->Y, to[0], to[1], v->X, v->Y}, * all;
+    int lsizes[2][2] = {{u->dimX, u->stride}, {v->dimX, v->stride}}, lo[2], hi[2], sub[2], start[2];
+    int * counts[2], * displs;
+    MPI_Datatype * types[2];
+
+    MPI_Comm_size ( comm, &size );
+    all = ( int * ) malloc ( 8 * size * sizeof ( int ) );
+    MPI_Allgather ( mine, 8, MPI_INT, all, 8, MPI_INT, comm );
+    displs = ( int * ) calloc ( size, sizeof ( int ) );
+    for ( d = 0; d < 2; d++ )
+        {
+            counts[d] = ( int * ) calloc ( size, sizeof ( int ) );
+            types[d] = ( MPI_Datatype * ) malloc ( size * sizeof ( MPI_Datatype ) );
+        }
+
+    //counts[0]/types[0]: what goes from u to q, counts[1]/types[1]: what comes from q into v
+    for ( q = 0; q < size; q++ )
+        {
+            types[0][q] = types[1][q] = MPI_DOUBLE;
+            if ( intersect ( mine, all + 8 * q + 4, lo, hi ) )
+                {
+                    for ( d = 0; d < 2; d++ )
+                        {
+                            sub[d] = hi[d] - lo[d];
+                            start[d] = lo[d] - from[d] + u->ghost;
+                        }
+                    MPI_Type_create_subarray ( 2, lsizes[0], sub, start, MPI_ORDER_C, MPI_DOUBLE, &types[0][q] );
+                    MPI_Type_commit ( &types[0][q] );
+                    counts[0][q] = 1;
+                }
+            if ( intersect ( all + 8 * q, mine + 4, lo, hi ) )
+                {
+                    for ( d = 0; d < 2; d++ )
+                        {
+                            sub[d] = hi[d] - lo[d];
+                            start[d] = lo[d] - to[d] + v->ghost;
+                        }
+                    MPI_Type_create_subarray ( 2, lsizes[1], sub, start, MPI_ORDER_C, MPI_DOUBLE, &types[1][q] );
+                    MPI_Type_commit ( &types[1][q] );
+                    counts[1][q] = 1;
+                }
+        }
+
+    MPI_Alltoallw ( u->data, counts[0], displs, types[0], v->data, counts[1], displs, types[1], comm );
+
+    for ( d = 0; d < 2; d++ )
+        {
+            for ( q = 0; q < size; q++ )
+                if ( counts[d][q] )
+                    MPI_Type_free ( &types[d][q] );
+            free ( counts[d] );
+            free ( types[d] );
+        }
+    free ( displs );
+    free ( all );
+}
+
+//MPI-IO hints for the binary output, from the options cb=enable|disable|automatic
+//(collective buffering of the writes), cb_nodes=n (processes that aggregate
+//them into file accesses) and cb_buffer=bytes (the buffer of every aggregator)
+//MPI_INFO_NULL if none is given, to leave every choice to the library
+MPI_Info output_hints ( int argc, char ** argv )
+{
+    MPI_Info info = MPI_INFO_NULL;
+    char v[32];
+    const char * cb = option_str ( argc, argv, "cb", NULL );
+    int nodes = option_int ( argc, argv, "cb_nodes", 0 ), buffer = option_int ( argc, argv, "cb_buffer", 0 );
+
+    if ( cb == NULL && nodes <= 0 && buffer <= 0 )
+        return info;
+    MPI_Info_create ( &info );
+    if ( cb != NULL )
+        MPI_Info_set ( info, "romio_cb_write", ( char * ) cb );
+    if ( nodes > 0 )
+        {
+            sprintf ( v, "%d", nodes );
+            MPI_Info_set ( info, "cb_nodes", v );
+        }
+    if ( buffer > 0 )
+        {
+            sprintf ( v, "%d", buffer );
+            MPI_Info_set ( info, "cb_buffer_size", v );
+        }
+    return info;
+}
+
+//Every process writes the interior of its block u, whose first point is at
+//global indices offset, into its place in the file s: the global grid in C
+//order, as doubles in native byte order, nothing else. The file view of a
+//process is a subarray of the global grid, the memory one a subarray of u, and
+//one MPI_File_write_at_all writes them all, so the library aggregates the
+//blocks into large contiguous accesses and nothing goes through rank 0
+//s only needs to be set on rank 0, which names the file
+static void store ( int ndims, const char * s, double * u, int * lsizes, int * lsub, int ghost, const int * offset, const int * global, MPI_Info info, MPI_Comm comm )
+{
+    int d, rank, err, start[3];
+    char name[256];
+    MPI_Offset bytes = sizeof ( double );
+    MPI_Datatype block, view;
+    MPI_File f;
+
+    MPI_Comm_rank ( comm, &rank );
+    if ( rank == 0 )
+        {
+            strncpy ( name, s, sizeof ( name ) - 1 );
+            name[sizeof ( name ) - 1] = '\0';
+        }
+    MPI_Bcast ( name, sizeof ( name ), MPI_CHAR, 0, comm );
+    err = MPI_File_open ( comm, name, MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &f );
+    if ( err != MPI_SUCCESS )
+        {
+            if ( rank == 0 )
+                fprintf ( stderr, "Cannot open %s\n", name );
+            return;
+        }
+
+    for ( d = 0; d < ndims; d++ )
+        {
+            start[d] = ghost;
+            bytes *= global[d];
+        }
+    MPI_Type_create_subarray ( ndims, lsizes, lsub, start, MPI_ORDER_C, MPI_DOUBLE, &block );
+    MPI_Type_commit ( &block );
+    MPI_Type_create_subarray ( ndims, ( int * ) global, lsub, ( int * ) offset, MPI_ORDER_C, MPI_DOUBLE, &view );
+    MPI_Type_commit ( &view );
+
+    //An older, longer file of the same name would keep its tail
+    MPI_File_set_size ( f, bytes );
+    MPI_File_set_view ( f, 0, MPI_DOUBLE, view, "native", info );
+    MPI_File_write_at_all ( f, 0, u, 1, block, MPI_STATUS_IGNORE );
+    MPI_File_close ( &f );
+
+    MPI_Type_free ( &block );
+    MPI_Type_free ( &view );
+}
+
+void write2d ( const char * s, grid2d * u, const int * offset, const int * global, MPI_Info info, MPI_Comm comm )
+{
+    int lsizes[2] = {u->dimX, u->stride}, lsub[2] = {u->X, u->Y};
+    store ( 2, s, u->data, lsizes, lsub, u->ghost, offset, global, info, comm );
+}
+
+void write3d ( const char * s, grid3d * u, const int * offset, const int * global, MPI_Info info, MPI_Comm comm )
+{
+    int lsizes[3] = {u->dimX, u->dimY, u->stride}, lsub[3] = {u->X, u->Y, u->Z};
+    store ( 3, s, u->data, lsizes, lsub, u->ghost, offset, global, info, comm );
+}
+
+//The value of global point (i, j) on rank 0, from the process that holds it:
+//what the report prints when no process holds the global grid
+double probe2d ( grid2d * u, const int * offset, int i, int j, MPI_Comm comm )
+{
+    double v = 0, w;
+    if ( i >= offset[0] && i < offset[0] + u->X && j >= offset[1] && j < offset[1] + u->Y )
+        v = G ( u, i - offset[0] + u->ghost, j - offset[1] + u->ghost );
+    MPI_Reduce ( &v, &w, 1, MPI_DOUBLE, MPI_SUM, 0, comm );
+    return w;
+}
+
+double probe3d ( grid3d * u, const int * offset, int i, int j, int l, MPI_Comm comm )
+{
+    double v = 0, w;
+    if ( i >= offset[0] && i < offset[0] + u->X && j >= offset[1] && j < offset[1] + u->Y && l >= offset[2] && l < offset[2] + u->Z )
+        v = G3 ( u, i - offset[0] + u->ghost, j - offset[1] + u->ghost, l - offset[2] + u->ghost );
+    MPI_Reduce ( &v, &w, 1, MPI_DOUBLE, MPI_SUM, 0, comm );
+    return w;
+}
@@ -0,0 +1,19 @@
+//Block decomposition of the global grid over a Cartesian process grid: its
+//collection on rank 0, its output by every process and its rebalancing at run time
+//Along every dimension the first n % p blocks get one point more than the
+//others, so blocks differ by at most one row or column and nothing is padded
+//Needs utils.h first, for grid2d and grid3d
+
+#include <mpi.h>
+
+int block_size ( int n, int p, int r );
+int block_start ( int n, int p, int r );
+void gather2d ( grid2d * U, grid2d * u, const int * global, MPI_Comm comm );
+void gather3d ( grid3d * U, grid3d * u, const int * global, MPI_Comm comm );
+MPI_Info output_hints ( int argc, char ** argv );
+void write2d ( const char * s, grid2d * u, const int * offset, const int * global, MPI_Info info, MPI_Comm comm );
+void write3d ( const char * s, grid3d * u, const int * offset, const int * global, MPI_Info info, MPI_Comm comm );
+double probe2d ( grid2d * u, const int * offset, int i, int j, MPI_Comm comm );
+double probe3d ( grid3d * u, const int * offset, int i, int j, int l, MPI_Comm comm );
+int balance_blocks ( double time, int ndims, const int * global, int * local, int * offset, int min, double tol, MPI_Comm comm );
+void redistribute2d ( grid2d * u, const int * from, grid2d * v, const int * to, MPI_Comm comm );
@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "dst.h"
+
+void dst_init ( dst_plan * p, int n )
+{
+    int k, r, m;
+    p->n = n;
+    p->N = 2 * ( n + 1 );
+    p->nf = 0;
+    p->maxf = 1;
+
+    //Radix 2 first: the generic butterfly of odd radices is O(p^2)
+    m = p->N;
+    for ( r = 2; m > 1; )
+        if ( m % r == 0 )
+            {
+                p->f[p->nf++] = r;
+                p->maxf = ( r > p->maxf ) ? r : p->maxf;
+                m /= r;
+            }
+        else
+            r = ( r * r > m ) ? m : r + 1;
+
+    p->tw = ( double complex * ) malloc ( p->N * sizeof ( double complex ) );
+    if ( p->tw == NULL )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+    for ( k = 0; k < p->N; k++ )
+        p->tw[k] = cexp ( -2 * M_PI * I * k / p->N );
+}
+
+//Complex elements of the scratch buffer one dst_lines call needs
+size_t dst_work ( const dst_plan * p )
+{
+    return 2 * ( size_t ) p->N + p->maxf;
+}
+
+//Decimation in time: out[0 .. n) is the DFT of in[0], in[s], .. in[(n - 1) s]
+//tw[k * ts] is e^(-2 pi i k / n)
+static void fft ( const dst_plan * p, const double complex * in, int s, double complex * out, int n, const int * f, int ts, double complex * scratch )
+{
+    int r = f[0], m = n / r;
+    int k, q, j;
+    double complex a, b;
+
+    if ( m == 1 )
+        for ( q = 0; q < r; q++ )
+            out[q] = in[q * s];
+    else
+        for ( q = 0; q < r; q++ )
+            fft ( p, in + q * s, s * r, out + q * m, m, f + 1, ts * r, scratch );
+
+    if ( r == 2 )
+        for ( k = 0; k < m; k++ )
+            {
+                a = out[k];
+                b = out[m + k] * p->tw[k * ts];
+                out[k] = a + b;
+                out[m + k] = a - b;
+            }
+    else
+        for ( k = 0; k < m; k++ )
+            {
+                for ( q = 0; q < r; q++ )
+                    scratch[q] = out[q * m + k] * p->tw[q * k * ts];
+                for ( j = 0; j < r; j++ )
+                    {
+                        a = scratch[0];
+                        for ( q = 1; q < r; q++ )
+                            a += scratch[q] * p->tw[ ( q * j % r ) * ( p->N / r )];
+                        out[j * m + k] = a;
+                    }
+            }
+}
+
+//DST of x and y in place, y may be NULL
+//The odd extension of x + i y has the FFT 2 Y - 2 i X
+void dst_lines ( const dst_plan * p, double * x, double * y, double complex * work )
+{
+    int j, n = p->n, N = p->N;
+    double complex * in = work, * out = work + N;
+
+    in[0] = in[n + 1] = 0;
+    for ( j = 1; j <= n; j++ )
+        {
+            in[j] = x[j - 1] + I * ( y ? y[j - 1] : 0 );
+            in[N - j] = -in[j];
+        }
+    fft ( p, in, 1, out, N, p->f, 1, work + 2 * N );
+    for ( j = 1; j <= n; j++ )
+        {
+            x[j - 1] = -cimag ( out[j] ) / 2;
+            if ( y )
+                y[j - 1] = creal ( out[j] ) / 2;
+        }
+}
+
+void dst_free ( dst_plan * p )
+{
+    free ( p->tw );
+}
@@ -0,0 +1,23 @@
+#include <stddef.h>
+#include <complex.h>
+
+//Discrete sine transform (DST-I) of real lines of n points:
+//X[k] = sum_j x[j] sin ( pi (j + 1) (k + 1) / (n + 1) ), k = 0 .. n - 1
+//It is its own inverse up to a factor (n + 1) / 2. A line is the imaginary
+//part of the FFT of its odd extension of length N = 2 (n + 1), and as that
+//FFT is otherwise real two lines go through one complex FFT
+//The FFT is mixed radix, so a large prime factor of N costs O(N p)
+typedef struct
+{
+    int n;               //line length
+    int N;               //FFT length
+    int nf;              //number of radices
+    int f[64];           //radices of N, outermost first
+    int maxf;            //largest radix
+    double complex * tw; //e^(-2 pi i k / N), k = 0 .. N - 1
+} dst_plan;
+
+void dst_init ( dst_plan * p, int n );
+size_t dst_work ( const dst_plan * p );
+void dst_lines ( const dst_plan * p, double * x, double * y, double complex * work );
+void dst_free ( dst_plan * p );
@@ -0,0 +1,178 @@
+#include "halo.h"
+
+/*
+Message Tags (point-to-point):
+Transfer Top Row 50
+Transfer Bottom Row 60
+Transfer East Column 70
+Transfer West Column 80
+Transfer Front Plane 110
+Transfer Back Plane 120
+*/
+static const int halo_tag[HALO_SIDES] = {50, 60, 80, 70, 110, 120};
+
+void halo_init ( halo2d * h, MPI_Comm comm, int nbr )
+{
+    int i;
+    h->comm = comm;
+    h->nbr = nbr;
+    h->n = 0;
+    h->phase = 0;
+    h->corners = 0;
+    h->stage = 0;
+    h->req[0] = MPI_REQUEST_NULL;
+    for ( i = 0; i < HALO_SIDES; i++ )
+        {
+            h->counts[i] = 0;
+            h->send[i] = h->recv[i] = 0;
+            h->types[i] = MPI_DOUBLE;
+        }
+}
+
+//Adds the exchange with the neighbour on one side, nothing if peer is -1
+//send goes to the neighbour, recv is filled with what it sends back
+void halo_side ( halo2d * h, int side, void * send, void * recv, MPI_Datatype type, int peer )
+{
+    if ( peer == -1 )
+        return;
+    if ( h->nbr )
+        {
+            h->counts[side] = 1;
+            h->types[side] = type;
+            MPI_Get_address ( send, &h->send[side] );
+            MPI_Get_address ( recv, &h->recv[side] );
+            h->n = 1;
+            return;
+        }
+    //The opposite side is side ^ 1, its tag is the one the neighbour sends with
+    MPI_Send_init ( send, 1, type, peer, halo_tag[side], h->comm, &h->req[h->n++] );
+    MPI_Recv_init ( recv, 1, type, peer, halo_tag[side ^ 1], h->comm, &h->req[h->n++] );
+}
+
+void halo_phase ( halo2d * h )
+{
+    h->phase = h->n;
+    h->corners = 1;
+}
+
+//Blocking exchange, one phase after the other
+void halo_exchange ( halo2d * h )
+{
+    if ( h->nbr )
+        {
+            if ( h->corners )
+                {
+                    //Rows along dimension 0 first, then the columns along dimension 1
+                    int rows[HALO_SIDES] = {h->counts[0], h->counts[1], 0, 0, 0, 0};
+                    int columns[HALO_SIDES] = {0, 0, h->counts[2], h->counts[3], h->counts[4], h->counts[5]};
+                    MPI_Neighbor_alltoallw ( MPI_BOTTOM, rows, h->send, h->types, MPI_BOTTOM, rows, h->recv, h->types, h->comm );
+                    MPI_Neighbor_alltoallw ( MPI_BOTTOM, columns, h->send, h->types, MPI_BOTTOM, columns, h->recv, h->types, h->comm );
+                }
+            else
+                MPI_Neighbor_alltoallw ( MPI_BOTTOM, h->counts, h->send, h->types, MPI_BOTTOM, h->counts, h->recv, h->types, h->comm );
+            return;
+        }
+    if ( h->phase == 0 || h->phase == h->n )
+        {
+            halo_start ( h );
+            halo_wait ( h );
+            return;
+        }
+    MPI_Startall ( h->phase, h->req );
+    MPI_Waitall ( h->phase, h->req, MPI_STATUSES_IGNORE );
+    MPI_Startall ( h->n - h->phase, h->req + h->phase );
+    MPI_Waitall ( h->n - h->phase, h->req + h->phase, MPI_STATUSES_IGNORE );
+}
+
+//Starts every side at once, or only the rows if the columns carry the corners
+void halo_start ( halo2d * h )
+{
+    int i;
+    h->stage = 2;
+    if ( h->n == 0 )
+        return;
+    if ( h->corners )
+        {
+            h->stage = 1;
+            if ( h->nbr )
+                {
+                    for ( i = 0; i < HALO_SIDES; i++ )
+                        {
+                            h->part[0][i] = ( i < 2 ) ? h->counts[i] : 0;
+                            h->part[1][i] = ( i < 2 ) ? 0 : h->counts[i];
+                        }
+                    MPI_Ineighbor_alltoallw ( MPI_BOTTOM, h->part[0], h->send, h->types, MPI_BOTTOM, h->part[0], h->recv, h->types, h->comm, &h->req[0] );
+                }
+            else
+                MPI_Startall ( h->phase, h->req );
+        }
+    else if ( h->nbr )
+        MPI_Ineighbor_alltoallw ( MPI_BOTTOM, h->counts, h->send, h->types, MPI_BOTTOM, h->counts, h->recv, h->types, h->comm, &h->req[0] );
+    else
+        MPI_Startall ( h->n, h->req );
+}
+
+//The columns after the rows
+static void halo_second ( halo2d * h )
+{
+    h->stage = 2;
+    if ( h->nbr )
+        MPI_Ineighbor_alltoallw ( MPI_BOTTOM, h->part[1], h->send, h->types, MPI_BOTTOM, h->part[1], h->recv, h->types, h->comm, &h->req[0] );
+    else
+        MPI_Startall ( h->n - h->phase, h->req + h->phase );
+}
+
+//Progresses a started exchange, 1 once it completed
+int halo_test ( halo2d * h )
+{
+    int flag = 1;
+    if ( h->stage == 1 )
+        {
+            MPI_Testall ( h->nbr ? 1 : h->phase, h->req, &flag, MPI_STATUSES_IGNORE );
+            if ( !flag )
+                return 0;
+            halo_second ( h );
+        }
+    if ( h->stage == 2 && h->n > 0 )
+        {
+            if ( h->nbr )
+                MPI_Testall ( 1, h->req, &flag, MPI_STATUSES_IGNORE );
+            else if ( h->corners )
+                MPI_Testall ( h->n - h->phase, h->req + h->phase, &flag, MPI_STATUSES_IGNORE );
+            else
+                MPI_Testall ( h->n, h->req, &flag, MPI_STATUSES_IGNORE );
+        }
+    if ( flag )
+        h->stage = 0;
+    return flag;
+}
+
+void halo_wait ( halo2d * h )
+{
+    if ( h->stage == 1 )
+        {
+            MPI_Waitall ( h->nbr ? 1 : h->phase, h->req, MPI_STATUSES_IGNORE );
+            halo_second ( h );
+        }
+    if ( h->stage == 2 && h->n > 0 )
+        {
+            if ( h->nbr )
+                MPI_Waitall ( 1, h->req, MPI_STATUSES_IGNORE );
+            else if ( h->corners )
+                MPI_Waitall ( h->n - h->phase, h->req + h->phase, MPI_STATUSES_IGNORE );
+            else
+                MPI_Waitall ( h->n, h->req, MPI_STATUSES_IGNORE );
+        }
+    h->stage = 0;
+}
+
+void halo_free ( halo2d * h )
+{
+    int i;
+    if ( !h->nbr )
+        for ( i = 0; i < h->n; i++ )
+            MPI_Request_free ( &h->req[i] );
+    h->n = 0;
+    h->phase = 0;
+    h->corners = 0;
+}
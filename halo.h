@@ -0,0 +1,39 @@
+#include <mpi.h>
+
+//Sides of a subdomain, in the neighbour order of a 2D Cartesian communicator;
+//a 3D one adds the two sides along its last dimension
+enum { HALO_NORTH, HALO_SOUTH, HALO_WEST, HALO_EAST, HALO_FRONT, HALO_BACK };
+
+#define HALO_SIDES 6
+
+//Halo exchange of one buffer, built once and restarted every iteration
+//Point-to-point: the send/receive pairs of every side are persistent requests
+//(MPI_Send_init/MPI_Recv_init) restarted with MPI_Startall
+//Neighbourhood collective: the whole halo is one MPI_Neighbor_alltoallw on
+//the Cartesian communicator, nonblocking with MPI_Ineighbor_alltoallw
+//Sides added after halo_phase only start once the earlier ones completed, so
+//the columns can carry the corners that the rows just delivered; a split-phase
+//exchange (halo_start, halo_test, halo_wait) starts them as soon as it sees that
+typedef struct
+{
+    MPI_Comm comm;             //communicator of the exchange, Cartesian for nbr
+    int nbr;                   //1: neighbourhood collective instead of point-to-point
+    MPI_Request req[2 * HALO_SIDES]; //persistent requests, or the single collective one
+    int n;                     //requests in use
+    int phase;                 //point-to-point: requests [0, phase) form the first phase
+    int corners;               //columns wait for the rows
+    int stage;                 //split phase: 1 the rows are in flight, 2 the rest, 0 done
+    int counts[HALO_SIDES];    //collective: 1 for every existing side
+    int part[2][HALO_SIDES];   //collective: counts of the rows and of the columns
+    MPI_Aint send[HALO_SIDES], recv[HALO_SIDES]; //collective: absolute addresses of the side buffers
+    MPI_Datatype types[HALO_SIDES]; //collective: datatype of every side
+} halo2d;
+
+void halo_init ( halo2d * h, MPI_Comm comm, int nbr );
+void halo_side ( halo2d * h, int side, void * send, void * recv, MPI_Datatype type, int peer );
+void halo_phase ( halo2d * h );
+void halo_exchange ( halo2d * h );
+void halo_start ( halo2d * h );
+int halo_test ( halo2d * h );
+void halo_wait ( halo2d * h );
+void halo_free ( halo2d * h );
@@ -0,0 +1,245 @@
+#include <math.h>
+#include "jacobi_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JACOBI_X86
+#endif
+
+//All variants add the four neighbours in the same order as the scalar
+//code and scale by 0.25, so they produce bitwise identical results
+
+void Jacobi_scalar ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    for ( i = X_min; i < X_max; i++ )
+        for ( j = Y_min; j < Y_max; j++ )
+            uc[i * s + j] = ( up[ ( i - 1 ) * s + j] + up[ ( i + 1 ) * s + j] + up[i * s + j - 1] + up[i * s + j + 1] ) * 0.25;
+}
+
+double JacobiRes_scalar ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    double d, r = 0;
+    for ( i = X_min; i < X_max; i++ )
+        for ( j = Y_min; j < Y_max; j++ )
+            {
+                uc[i * s + j] = ( up[ ( i - 1 ) * s + j] + up[ ( i + 1 ) * s + j] + up[i * s + j - 1] + up[i * s + j + 1] ) * 0.25;
+                d = fabs ( uc[i * s + j] - up[i * s + j] );
+                r = ( d > r ) ? d : r;
+            }
+    return r;
+}
+
+#ifdef JACOBI_X86
+
+__attribute__ ( ( target ( "sse2" ) ) )
+void Jacobi_sse2 ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    const __m128d quarter = _mm_set1_pd ( 0.25 );
+    for ( i = X_min; i < X_max; i++ )
+        {
+            const double * n = up + ( i - 1 ) * s, * c = up + i * s, * d = up + ( i + 1 ) * s;
+            double * o = uc + i * s;
+            for ( j = Y_min; j + 2 <= Y_max; j += 2 )
+                {
+                    __m128d v = _mm_add_pd ( _mm_loadu_pd ( n + j ), _mm_loadu_pd ( d + j ) );
+                    v = _mm_add_pd ( v, _mm_loadu_pd ( c + j - 1 ) );
+                    v = _mm_add_pd ( v, _mm_loadu_pd ( c + j + 1 ) );
+                    _mm_storeu_pd ( o + j, _mm_mul_pd ( v, quarter ) );
+                }
+            for ( ; j < Y_max; j++ )
+                o[j] = ( n[j] + d[j] + c[j - 1] + c[j + 1] ) * 0.25;
+        }
+}
+
+__attribute__ ( ( target ( "sse2" ) ) )
+double JacobiRes_sse2 ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    double r[2];
+    const __m128d quarter = _mm_set1_pd ( 0.25 ), sign = _mm_set1_pd ( -0.0 );
+    __m128d m = _mm_setzero_pd ( );
+    for ( i = X_min; i < X_max; i++ )
+        {
+            const double * n = up + ( i - 1 ) * s, * c = up + i * s, * d = up + ( i + 1 ) * s;
+            double * o = uc + i * s;
+            for ( j = Y_min; j + 2 <= Y_max; j += 2 )
+                {
+                    __m128d v = _mm_add_pd ( _mm_loadu_pd ( n + j ), _mm_loadu_pd ( d + j ) );
+                    v = _mm_add_pd ( v, _mm_loadu_pd ( c + j - 1 ) );
+                    v = _mm_add_pd ( v, _mm_loadu_pd ( c + j + 1 ) );
+                    v = _mm_mul_pd ( v, quarter );
+                    _mm_storeu_pd ( o + j, v );
+                    m = _mm_max_pd ( m, _mm_andnot_pd ( sign, _mm_sub_pd ( v, _mm_loadu_pd ( c + j ) ) ) );
+                }
+            for ( ; j < Y_max; j++ )
+                {
+                    o[j] = ( n[j] + d[j] + c[j - 1] + c[j + 1] ) * 0.25;
+                    m = _mm_max_pd ( m, _mm_set1_pd ( fabs ( o[j] - c[j] ) ) );
+                }
+        }
+    _mm_storeu_pd ( r, m );
+    return ( r[0] > r[1] ) ? r[0] : r[1];
+}
+
+__attribute__ ( ( target ( "avx2" ) ) )
+void Jacobi_avx2 ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    const __m256d quarter = _mm256_set1_pd ( 0.25 );
+    for ( i = X_min; i < X_max; i++ )
+        {
+            const double * n = up + ( i - 1 ) * s, * c = up + i * s, * d = up + ( i + 1 ) * s;
+            double * o = uc + i * s;
+            for ( j = Y_min; j + 4 <= Y_max; j += 4 )
+                {
+                    __m256d v = _mm256_add_pd ( _mm256_loadu_pd ( n + j ), _mm256_loadu_pd ( d + j ) );
+                    v = _mm256_add_pd ( v, _mm256_loadu_pd ( c + j - 1 ) );
+                    v = _mm256_add_pd ( v, _mm256_loadu_pd ( c + j + 1 ) );
+                    _mm256_storeu_pd ( o + j, _mm256_mul_pd ( v, quarter ) );
+                }
+            for ( ; j < Y_max; j++ )
+                o[j] = ( n[j] + d[j] + c[j - 1] + c[j + 1] ) * 0.25;
+        }
+}
+
+__attribute__ ( ( target ( "avx2" ) ) )
+double JacobiRes_avx2 ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    double r[4];
+    const __m256d quarter = _mm256_set1_pd ( 0.25 ), sign = _mm256_set1_pd ( -0.0 );
+    __m256d m = _mm256_setzero_pd ( );
+    for ( i = X_min; i < X_max; i++ )
+        {
+            const double * n = up + ( i - 1 ) * s, * c = up + i * s, * d = up + ( i + 1 ) * s;
+            double * o = uc + i * s;
+            for ( j = Y_min; j + 4 <= Y_max; j += 4 )
+                {
+                    __m256d v = _mm256_add_pd ( _mm256_loadu_pd ( n + j ), _mm256_loadu_pd ( d + j ) );
+                    v = _mm256_add_pd ( v, _mm256_loadu_pd ( c + j - 1 ) );
+                    v = _mm256_add_pd ( v, _mm256_loadu_pd ( c + j + 1 ) );
+                    v = _mm256_mul_pd ( v, quarter );
+                    _mm256_storeu_pd ( o + j, v );
+                    m = _mm256_max_pd ( m, _mm256_andnot_pd ( sign, _mm256_sub_pd ( v, _mm256_loadu_pd ( c + j ) ) ) );
+                }
+            for ( ; j < Y_max; j++ )
+                {
+                    o[j] = ( n[j] + d[j] + c[j - 1] + c[j + 1] ) * 0.25;
+                    m = _mm256_max_pd ( m, _mm256_set1_pd ( fabs ( o[j] - c[j] ) ) );
+                }
+        }
+    _mm256_storeu_pd ( r, m );
+    r[0] = ( r[0] > r[1] ) ? r[0] : r[1];
+    r[2] = ( r[2] > r[3] ) ? r[2] : r[3];
+    return ( r[0] > r[2] ) ? r[0] : r[2];
+}
+
+//The tail at Y_max is handled with a masked load/store instead of a scalar loop
+__attribute__ ( ( target ( "avx512f" ) ) )
+void Jacobi_avx512 ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    const __m512d quarter = _mm512_set1_pd ( 0.25 );
+    for ( i = X_min; i < X_max; i++ )
+        {
+            const double * n = up + ( i - 1 ) * s, * c = up + i * s, * d = up + ( i + 1 ) * s;
+            double * o = uc + i * s;
+            for ( j = Y_min; j < Y_max; j += 8 )
+                {
+                    __mmask8 m = ( Y_max - j >= 8 ) ? 0xFF : ( __mmask8 ) ( ( 1u << ( Y_max - j ) ) - 1 );
+                    __m512d v = _mm512_add_pd ( _mm512_maskz_loadu_pd ( m, n + j ), _mm512_maskz_loadu_pd ( m, d + j ) );
+                    v = _mm512_add_pd ( v, _mm512_maskz_loadu_pd ( m, c + j - 1 ) );
+                    v = _mm512_add_pd ( v, _mm512_maskz_loadu_pd ( m, c + j + 1 ) );
+                    _mm512_mask_storeu_pd ( o + j, m, _mm512_mul_pd ( v, quarter ) );
+                }
+        }
+}
+
+//Masked-off lanes load zeros on both sides, so their update is 0
+__attribute__ ( ( target ( "avx512f" ) ) )
+double JacobiRes_avx512 ( const double * restrict up, double * restrict uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    const __m512d quarter = _mm512_set1_pd ( 0.25 );
+    __m512d m = _mm512_setzero_pd ( );
+    for ( i = X_min; i < X_max; i++ )
+        {
+            const double * n = up + ( i - 1 ) * s, * c = up + i * s, * d = up + ( i + 1 ) * s;
+            double * o = uc + i * s;
+            for ( j = Y_min; j < Y_max; j += 8 )
+                {
+                    __mmask8 k = ( Y_max - j >= 8 ) ? 0xFF : ( __mmask8 ) ( ( 1u << ( Y_max - j ) ) - 1 );
+                    __m512d v = _mm512_add_pd ( _mm512_maskz_loadu_pd ( k, n + j ), _mm512_maskz_loadu_pd ( k, d + j ) );
+                    v = _mm512_add_pd ( v, _mm512_maskz_loadu_pd ( k, c + j - 1 ) );
+                    v = _mm512_add_pd ( v, _mm512_maskz_loadu_pd ( k, c + j + 1 ) );
+                    v = _mm512_mul_pd ( v, quarter );
+                    _mm512_mask_storeu_pd ( o + j, k, v );
+                    m = _mm512_max_pd ( m, _mm512_abs_pd ( _mm512_sub_pd ( v, _mm512_maskz_loadu_pd ( k, c + j ) ) ) );
+                }
+        }
+    return _mm512_reduce_max_pd ( m );
+}
+
+const char * jacobi_select ( jacobi_kernel_t * kernel, jacobi_res_kernel_t * res_kernel )
+{
+    __builtin_cpu_init ( );
+    if ( __builtin_cpu_supports ( "avx512f" ) )
+        {
+            *kernel = Jacobi_avx512;
+            *res_kernel = JacobiRes_avx512;
+            return "avx512";
+        }
+    if ( __builtin_cpu_supports ( "avx2" ) )
+        {
+            *kernel = Jacobi_avx2;
+            *res_kernel = JacobiRes_avx2;
+            return "avx2";
+        }
+    *kernel = Jacobi_sse2;
+    *res_kernel = JacobiRes_sse2;
+    return "sse2";
+}
+
+#else
+
+void Jacobi_sse2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    Jacobi_scalar ( up, uc, s, X_min, X_max, Y_min, Y_max );
+}
+
+void Jacobi_avx2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    Jacobi_scalar ( up, uc, s, X_min, X_max, Y_min, Y_max );
+}
+
+void Jacobi_avx512 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    Jacobi_scalar ( up, uc, s, X_min, X_max, Y_min, Y_max );
+}
+
+double JacobiRes_sse2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    return JacobiRes_scalar ( up, uc, s, X_min, X_max, Y_min, Y_max );
+}
+
+double JacobiRes_avx2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    return JacobiRes_scalar ( up, uc, s, X_min, X_max, Y_min, Y_max );
+}
+
+double JacobiRes_avx512 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max )
+{
+    return JacobiRes_scalar ( up, uc, s, X_min, X_max, Y_min, Y_max );
+}
+
+const char * jacobi_select ( jacobi_kernel_t * kernel, jacobi_res_kernel_t * res_kernel )
+{
+    *kernel = Jacobi_scalar;
+    *res_kernel = JacobiRes_scalar;
+    return "scalar";
+}
+
+#endif
@@ -0,0 +1,18 @@
+//Interior Jacobi sweep on a flat array with row stride s
+typedef void ( * jacobi_kernel_t ) ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+
+void Jacobi_scalar ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+void Jacobi_sse2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+void Jacobi_avx2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+void Jacobi_avx512 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+
+//The same sweep, also returning the max-norm of the update |uc - up|
+typedef double ( * jacobi_res_kernel_t ) ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+
+double JacobiRes_scalar ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+double JacobiRes_sse2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+double JacobiRes_avx2 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+double JacobiRes_avx512 ( const double * up, double * uc, int s, int X_min, int X_max, int Y_min, int Y_max );
+
+//Picks the widest variants the CPU supports, returns their name
+const char * jacobi_select ( jacobi_kernel_t * kernel, jacobi_res_kernel_t * res_kernel );
@@ -5,41 +5,54 @@
 #include <sys/time.h>
 #include <mpi.h>
 #include <utils.h>
+#include <decomp.h>
 
 //Computational Kernels
 
-void Jacobi(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max)
+void Jacobi(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1]) / 4.0;
+            uc[i * s + j] = (up[(i - 1) * s + j] + up[(i + 1) * s + j] + up[i * s + j - 1] + up[i * s + j + 1]) / 4.0;
 }
 
-void GaussSeidel(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+void GaussSeidel(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = u_previous[i][j] + (u_current[i - 1][j] + u_previous[i + 1][j] + u_current[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]) * omega / 4.0;
+            uc[i * s + j] = up[i * s + j] + (uc[(i - 1) * s + j] + up[(i + 1) * s + j] + uc[i * s + j - 1] + up[i * s + j + 1] - 4 * up[i * s + j]) * omega / 4.0;
 }
 
-void RedSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+void RedSOR(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
             if ((i + j) % 2 == 0)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]);
+                uc[i * s + j] = up[i * s + j] + (omega / 4.0) * (up[(i - 1) * s + j] + up[(i + 1) * s + j] + up[i * s + j - 1] + up[i * s + j + 1] - 4 * up[i * s + j]);
 }
 
-void BlackSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+void BlackSOR(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
             if ((i + j) % 2 == 1)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_current[i - 1][j] + u_current[i + 1][j] + u_current[i][j - 1] + u_current[i][j + 1] - 4 * u_previous[i][j]);
+                uc[i * s + j] = up[i * s + j] + (omega / 4.0) * (uc[(i - 1) * s + j] + uc[(i + 1) * s + j] + uc[i * s + j - 1] + uc[i * s + j + 1] - 4 * up[i * s + j]);
 }
 
 
@@ -47,9 +60,9 @@ int main(int argc, char ** argv)
 {
     int rank, size;
     int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
-    int global_padded[2];   //padded global matrix dimensions (if padding is not needed, global_padded=global)
+    int offset[2];          //global indices of the first row and column of the subdomain
     int grid[2];            //processor grid dimensions
-    int i, j, t;
+    int i, t;
     int global_converged = 0, converged = 0; //flags for convergence, global and per process
     MPI_Datatype dummy;     //dummy datatype used to align user-defined datatypes in memory
     double omega;           //relaxation factor - useless for Jacobi
@@ -57,7 +70,7 @@ int main(int argc, char ** argv)
     struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
     double ttotal = 0, tcomp = 0, total_time, comp_time;
 
-    double ** U, ** u_current, ** u_previous, ** swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
+    grid2d * U, * u_current, * u_previous, * swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
 
 
     MPI_Init(&argc, &argv);
@@ -92,21 +105,12 @@ int main(int argc, char ** argv)
     MPI_Barrier(CART_COMM);
     MPI_Barrier(MPI_COMM_WORLD);
     //----Compute local 2D-subdomain dimensions----//
-    //----Test if the 2D-domain can be equally distributed to all processes----//
-    //----If not, pad 2D-domain----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
 
     for (i = 0; i < 2; i++)
         {
-            if (global[i] % grid[i] == 0)
-                {
-                    local[i] = global[i] / grid[i];
-                    global_padded[i] = global[i];
-                }
-            else
-                {
-                    local[i] = (global[i] / grid[i]) + 1;
-                    global_padded[i] = local[i] * grid[i];
-                }
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
         }
 
     //Initialization of omega
@@ -117,65 +121,16 @@ int main(int argc, char ** argv)
     omega = 2.0 / (1 + sin(3.14 / local[0]));
 #   endif
 
-    //----Allocate global 2D-domain and initialize boundary values----//
-    //----Rank 0 holds the global 2D-domain----//
-    if (rank == 0)
-        {
-            U = allocate2d(global_padded[0], global_padded[1]);
-            init2d(U, global[0], global[1]);
-        }
-
     //----Allocate local 2D-subdomains u_current, u_previous----//
     //----Add a row/column on each size for ghost cells----//
 
-    u_previous = allocate2d(local[0] + 2, local[1] + 2);
-    u_current = allocate2d(local[0] + 2, local[1] + 2);
+    u_previous = allocate2d(local[0], local[1], 1);
+    u_current = allocate2d(local[0], local[1], 1);
 
-    //----Distribute global 2D-domain from rank 0 to all processes----//
+    //----Every process initializes the interior of its own block from its global position----//
 
-    //----Appropriate datatypes are defined here----//
-    /*****The usage of datatypes is optional*****/
-
-    //----Datatype definition for the 2D-subdomain on the global matrix----//
-
-    MPI_Datatype global_block;
-    MPI_Type_vector(local[0], local[1], global_padded[1], MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &global_block);
-    MPI_Type_commit(&global_block);
-
-    //----Datatype definition for the 2D-subdomain on the local matrix----//
-
-    MPI_Datatype local_block;
-    MPI_Type_vector(local[0], local[1], local[1] + 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &local_block);
-    MPI_Type_commit(&local_block);
-
-    //----Rank 0 defines positions and counts of local blocks (2D-subdomains) on global matrix----//
-    int * scatteroffset, * scattercounts;
-    if (rank == 0)
-        {
-            scatteroffset = (int*)malloc(size * sizeof(int));
-            scattercounts = (int*)malloc(size * sizeof(int));
-            for (i = 0; i < grid[0]; i++)
-                for (j = 0; j < grid[1]; j++)
-                    {
-                        scattercounts[i * grid[1] + j] = 1;
-                        scatteroffset[i * grid[1] + j] = (local[0] * local[1] * grid[1] * i + local[1] * j);
-                    }
-        }
-
-
-    //----Rank 0 scatters the global matrix----//
-
-    double * initaddr;
-    if (rank == 0)
-        initaddr = &(U[0][0]);
-
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_previous[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_current[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
-
-    if (rank == 0)
-        free2d(U, global_padded[0], global_padded[1]);
+    init_block2d(u_previous, offset[0], offset[1]);
+    init_block2d(u_current, offset[0], offset[1]);
 
     //----Define datatypes or allocate buffers for message passing----//
     MPI_Datatype mat_row;
@@ -184,7 +139,7 @@ int main(int argc, char ** argv)
     MPI_Type_commit(&mat_row);
 
     MPI_Datatype mat_column;
-    MPI_Type_vector(local[0], 1, local[1] + 2, MPI_DOUBLE, &dummy);
+    MPI_Type_vector(local[0], 1, u_previous->stride, MPI_DOUBLE, &dummy);
     MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
     MPI_Type_commit(&mat_column);
 
@@ -240,10 +195,9 @@ int main(int argc, char ** argv)
 
     int i_min, i_max, j_min, j_max;
 
-    /*Three types of ranges:
+    /*Two types of ranges over the local[0] x local[1] block (block_size):
         -internal processes
-        -boundary processes
-        -boundary processes and padded global array
+        -boundary processes, whose first or last row or column is the global boundary
     */
 
     //Init Values for internal processes
@@ -273,17 +227,6 @@ int main(int argc, char ** argv)
             j_max -= 1;
         }
 
-    //Fix Padded Bounds
-    if (rank_grid[0] == grid[0] - 1)
-        {
-            i_max -= global_padded[0] - global[0];
-        }
-
-    if (rank_grid[1] == grid[1] - 1)
-        {
-            j_max -= global_padded[1] - global[1];
-        }
-
 
 
     printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
@@ -330,16 +273,16 @@ int main(int argc, char ** argv)
                             if (north != -1)
                                 {
                                     //Send top row to north
-                                    MPI_Isend(&u_previous[1][1], 1, mat_row, north, 50, MPI_COMM_WORLD, &mpi_reqns_1);
+                                    MPI_Isend(&G(u_previous, 1, 1), 1, mat_row, north, 50, MPI_COMM_WORLD, &mpi_reqns_1);
                                     //Receive lower row from north
-                                    MPI_Irecv(&u_previous[0][1], 1, mat_row, north, 60, MPI_COMM_WORLD, &mpi_reqns_2);
+                                    MPI_Irecv(&G(u_previous, 0, 1), 1, mat_row, north, 60, MPI_COMM_WORLD, &mpi_reqns_2);
                                 }
                             if (south != -1)
                                 {
                                     //Send bottom row to south
-                                    MPI_Isend(&u_previous[i_max - 1][1], 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns_2);
+                                    MPI_Isend(&G(u_previous, i_max - 1, 1), 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns_2);
                                     //Receive top row from south
-                                    MPI_Irecv(&u_previous[i_max][1], 1, mat_row, south, 50, MPI_COMM_WORLD, &mpi_reqns_1);
+                                    MPI_Irecv(&G(u_previous, i_max, 1), 1, mat_row, south, 50, MPI_COMM_WORLD, &mpi_reqns_1);
                                 }
                             //Wait for completion
                             MPI_Wait(&mpi_reqns_1, &mpistatus);
@@ -351,15 +294,15 @@ int main(int argc, char ** argv)
                             if (east != -1)
                                 {
                                     //Send Right Column to east
-                                    MPI_Isend(&u_previous[i_min][j_max - 1], 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
+                                    MPI_Isend(&G(u_previous, i_min, j_max - 1), 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
                                     //Receive
-                                    MPI_Irecv(&u_previous[i_min][j_max], 1, mat_column, east, 80, MPI_COMM_WORLD, &mpi_reqew_2);
+                                    MPI_Irecv(&G(u_previous, i_min, j_max), 1, mat_column, east, 80, MPI_COMM_WORLD, &mpi_reqew_2);
                                 }
                             if (west != -1)
                                 {
-                                    MPI_Isend(&u_previous[i_min][j_min], 1, mat_column, west, 80, MPI_COMM_WORLD, &mpi_reqew_2);
+                                    MPI_Isend(&G(u_previous, i_min, j_min), 1, mat_column, west, 80, MPI_COMM_WORLD, &mpi_reqew_2);
                                     //Receive left column from west
-                                    MPI_Irecv(&u_previous[i_min][0], 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
+                                    MPI_Irecv(&G(u_previous, i_min, 0), 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
                                 }
                             //Wait for completion
                             MPI_Wait(&mpi_reqew_1, &mpistatus);
@@ -384,7 +327,7 @@ int main(int argc, char ** argv)
                         {
                             //*************TODO**************//
                             /*Test convergence*/
-                            converged = converge(&(u_previous[1]), &(u_current[1]), local[0], local[1]);
+                            converged = converge(u_previous, u_current, i_min, i_max, j_min, j_max);
                             if (converged)
                                 printf("Process: %d Converged\n", rank);
                             MPI_Allreduce(&converged, &global_converged, 1, MPI_INT, MPI_BAND, MPI_COMM_WORLD);
@@ -410,15 +353,14 @@ int main(int argc, char ** argv)
             //----Rank 0 gathers local matrices back to the global matrix----//
             if (rank == 0)
                 {
-                    U = allocate2d(global_padded[0], global_padded[1]);
-                    initaddr = &(U[0][0]);
+                    U = allocate2d(global[0], global[1], 0);
                     printf("Value of T : %d\n", T);
                 }
 
 
             //All Processes send data back to rank0,  rank0 receives
-            //Use Gatherv Command
-            MPI_Gatherv(&(u_current[1][1]), 1, local_block, initaddr, scattercounts, scatteroffset, global_block, 0, MPI_COMM_WORLD);
+            //Every block is received into its place by a subarray datatype
+            gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
 
 
             //************************************//
@@ -434,19 +376,19 @@ int main(int argc, char ** argv)
 
 #           ifdef JACOBI
                     printf("Jacobi X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, G(U, global[0] / 2, global[1] / 2));
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "Jacobi", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef GSSOR
                     printf("GaussSeidel X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, G(U, global[0] / 2, global[1] / 2));
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "GaussSeidel", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef REDBLACK
                     printf("RedBlackSOR X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, G(U, global[0] / 2, global[1] / 2));
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "RedBlackSOR", global[0], global[1], grid[0], grid[1]);
 #           endif
 
@@ -0,0 +1,517 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <mpi.h>
+#include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#include "stencil.h"
+
+//Computational Kernels
+
+//Jacobi sweep of the 7-point Laplacian: every thread sweeps its own band of
+//planes, and every row runs along the unit-stride dimension
+//With the constant res flag set it also returns the max-norm of the update
+static inline double JacobiSweep(grid3d * u_previous, grid3d * u_current, int X_min, int X_max, int Y_min, int Y_max, int Z_min, int Z_max, const int res)
+{
+    double r = 0;
+#   pragma omp parallel reduction(max:r)
+    {
+        int i, j, l, lo, hi;
+        double d;
+        const int s = u_previous->stride;
+        const size_t p = u_previous->plane;
+        thread_rows(X_min, X_max, &lo, &hi);
+        for (i = lo; i < hi; i++)
+            for (j = Y_min; j < Y_max; j++)
+                {
+                    const double * restrict up = u_previous->data + i * p + (size_t)j * s;
+                    double * restrict uc = u_current->data + i * p + (size_t)j * s;
+                    for (l = Z_min; l < Z_max; l++)
+                        {
+                            uc[l] = STENCIL7(up, up, p, s, l);
+                            if (res)
+                                {
+                                    d = fabs(uc[l] - up[l]);
+                                    r = (d > r) ? d : r;
+                                }
+                        }
+                }
+    }
+    return r;
+}
+
+//Plain sweep if res is NULL, else the fused one folding its update norm into *res,
+//so a convergence test costs no second pass over the grids
+void Jacobi(grid3d * u_previous, grid3d * u_current, int X_min, int X_max, int Y_min, int Y_max, int Z_min, int Z_max, double * res)
+{
+    double r;
+    if (res == NULL)
+        JacobiSweep(u_previous, u_current, X_min, X_max, Y_min, Y_max, Z_min, Z_max, 0);
+    else
+        {
+            r = JacobiSweep(u_previous, u_current, X_min, X_max, Y_min, Y_max, Z_min, Z_max, 1);
+            if (r > *res)
+                *res = r;
+        }
+}
+
+//In-place SOR sweep over one colour of the split checkerboard, as in the 2D
+//red-black skeleton: own holds the colour being updated, other its 6 neighbours
+//Row (i, j) of the colour starts at column (i + j + first) % 2, so its neighbours
+//along the rows are other-grid columns k + f - 1 and k + f, and every other
+//neighbour sits at column k of the other grid: all loads are unit stride
+static inline double ColourSweep(grid3d * own, grid3d * other, int first, int X_min, int X_max, int Y_min, int Y_max, int Z_min, int Z_max, double omega, const int res)
+{
+    int i, j, k, f, k_min, k_max;
+    double v, d, r = 0;
+    const int s = own->stride;
+    const size_t p = own->plane;
+#   pragma omp parallel for private(j, k, f, k_min, k_max, v, d) reduction(max:r) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            {
+                f = (i + j + first) & 1;
+                k_min = (Z_min - f + 1) >> 1;
+                k_max = (Z_max - f + 1) >> 1;
+                double * restrict o = own->data + i * p + (size_t)j * s;
+                const double * c = other->data + i * p + (size_t)j * s;
+                const double * n = c - p, * b = c + p, * w = c - s, * a = c + s, * m = c + f - 1;
+                for (k = k_min; k < k_max; k++)
+                    {
+                        v = o[k] + (omega / 6.0) * (n[k] + b[k] + w[k] + a[k] + m[k] + m[k + 1] - 6 * o[k]);
+                        if (res)
+                            {
+                                d = fabs(v - o[k]);
+                                r = (d > r) ? d : r;
+                            }
+                        o[k] = v;
+                    }
+            }
+    return r;
+}
+
+void ColourSOR(grid3d * own, grid3d * other, int first, int X_min, int X_max, int Y_min, int Y_max, int Z_min, int Z_max, double omega, double * res)
+{
+    double r;
+    if (res == NULL)
+        ColourSweep(own, other, first, X_min, X_max, Y_min, Y_max, Z_min, Z_max, omega, 0);
+    else
+        {
+            r = ColourSweep(own, other, first, X_min, X_max, Y_min, Y_max, Z_min, Z_max, omega, 1);
+            if (r > *res)
+                *res = r;
+        }
+}
+
+//Halo exchange of the six faces of a grid of dimX x dimY x stride doubles
+//A face along a dimension is a subarray one element thick, addressed from its
+//first element, so the same datatype serves both sides; a colour grid instead
+//takes the face along its rows (dimension 2) as the checkerboard of rows that
+//hold it (column), placed at the first row that has the colour there
+void FaceHalo(halo2d * h, MPI_Comm comm, int nbr, grid3d * u, int colour, int first, int * peer, int i_max, int j_max, int l_max, MPI_Datatype * face)
+{
+    halo_init(h, comm, nbr);
+    halo_side(h, HALO_NORTH, &G3(u, 1, 1, colour ? 0 : 1), &G3(u, 0, 1, colour ? 0 : 1), face[0], peer[HALO_NORTH]);
+    halo_side(h, HALO_SOUTH, &G3(u, i_max - 1, 1, colour ? 0 : 1), &G3(u, i_max, 1, colour ? 0 : 1), face[0], peer[HALO_SOUTH]);
+    halo_side(h, HALO_WEST, &G3(u, 1, 1, colour ? 0 : 1), &G3(u, 1, 0, colour ? 0 : 1), face[1], peer[HALO_WEST]);
+    halo_side(h, HALO_EAST, &G3(u, 1, j_max - 1, colour ? 0 : 1), &G3(u, 1, j_max, colour ? 0 : 1), face[1], peer[HALO_EAST]);
+    if (!colour)
+        {
+            halo_side(h, HALO_FRONT, &G3(u, 1, 1, 1), &G3(u, 1, 1, 0), face[2], peer[HALO_FRONT]);
+            halo_side(h, HALO_BACK, &G3(u, 1, 1, l_max - 1), &G3(u, 1, 1, l_max), face[2], peer[HALO_BACK]);
+            return;
+        }
+    halo_side(h, HALO_FRONT, &G3(u, 0, (1 + first) & 1, 0), &G3(u, 0, first & 1, 0), face[2], peer[HALO_FRONT]);
+    halo_side(h, HALO_BACK, &G3(u, 0, (l_max - 1 + first) & 1, (l_max - 1) / 2), &G3(u, 0, (l_max + first) & 1, l_max / 2), face[2], peer[HALO_BACK]);
+}
+
+//Face datatypes of a dimX x dimY x stride grid with an X x Y x Z interior:
+//a plane, a row of planes and a column of rows, or for a colour grid the
+//full rows of the first two and the checkerboard (i + j even) of the third
+void FaceTypes(grid3d * u, int X, int Y, int Z, int colour, MPI_Datatype * face)
+{
+    int sizes[3] = {u->dimX, u->dimY, u->stride}, starts[3] = {0, 0, 0};
+    int plane[3] = {1, Y, colour ? u->dimZ : Z}, row[3] = {X, 1, colour ? u->dimZ : Z}, column[3] = {X, Y, 1};
+    int i, j, n = 0, * displs;
+
+    MPI_Type_create_subarray(3, sizes, plane, starts, MPI_ORDER_C, MPI_DOUBLE, &face[0]);
+    MPI_Type_create_subarray(3, sizes, row, starts, MPI_ORDER_C, MPI_DOUBLE, &face[1]);
+    if (!colour)
+        MPI_Type_create_subarray(3, sizes, column, starts, MPI_ORDER_C, MPI_DOUBLE, &face[2]);
+    else
+        {
+            displs = (int*)malloc(((size_t)u->dimX * u->dimY / 2 + 1) * sizeof(int));
+            for (i = 0; i < u->dimX; i++)
+                for (j = (i & 1); j < u->dimY - 1; j += 2)
+                    displs[n++] = (int)(i * u->plane) + j * u->stride;
+            MPI_Type_create_indexed_block(n, 1, displs, MPI_DOUBLE, &face[2]);
+            free(displs);
+        }
+    for (i = 0; i < 3; i++)
+        MPI_Type_commit(&face[i]);
+}
+
+
+int main(int argc, char ** argv)
+{
+    int rank, size;
+    int global[3], local[3]; //global matrix dimensions and local matrix dimensions (3D-domain, 3D-subdomain)
+    int offset[3];          //global indices of the first point of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
+    int grid[3];            //processor grid dimensions
+    int i, j, t;
+    int global_converged = 0, converged = 0; //flags for convergence, global and per process
+#   ifdef REDBLACK
+    double omega;           //relaxation factor
+#   endif
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    conv_sched sched;       //when to test: every C iterations or adaptive
+    int check = 0;          //this iteration tests convergence
+    double res;             //max-norm of the update of a test iteration
+    double conv_global;     //update norm of a test over all processes
+
+    struct timeval tts, ttf; //Timers: total-tts,ttf
+    double ttotal = 0, tcomp = 0, total_time, comp_time;
+    double tc0, tsweep;     //Timers of the sweeps of a single iteration
+    double tw0, tcomm = 0, comm_time; //Accumulated halo exchange time
+    double tkernel = 0, kernel_time, flops, total_flops; //Accumulated sweep time and flop count for GFLOP/s
+
+    grid3d * U, * u_local; //Global matrix, local matrix in natural order
+#   ifdef JACOBI
+    grid3d * u_current, * u_previous, * swap; //local current and previous matrices, pointer to swap between current and previous
+#   endif
+#   ifdef REDBLACK
+    rbgrid3d * u_rb; //local matrix split into its colours, updated in place
+#   endif
+
+
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
+    MPI_Init(&argc, &argv);
+#   endif
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    //----Read 3D-domain dimensions and process grid dimensions from stdin----//
+
+    if (argc < 7)
+        {
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Z Px Py Pz [omega=auto|w] [halo=p2p|nbr] [every=auto|iters] [cmin=iters] [cmax=iters] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
+            exit(-1);
+        }
+    for (i = 0; i < 3; i++)
+        {
+            global[i] = atoi(argv[1 + i]);
+            grid[i] = atoi(argv[4 + i]);
+        }
+    if (grid[0] * grid[1] * grid[2] != size)
+        {
+            if (rank == 0)
+                fprintf(stderr, "Px * Py * Pz must be the number of processes\n");
+            MPI_Abort(MPI_COMM_WORLD, -1);
+        }
+
+    //----Create 3D-cartesian communicator----//
+
+    MPI_Comm CART_COMM;           //CART_COMM: the new 3D-cartesian communicator
+    int periods[3] = {0, 0, 0};   //periods={0,0,0}: the 3D-grid is non-periodic
+    int rank_grid[3];             //rank_grid: the position of each process on the new communicator
+
+    MPI_Cart_create(MPI_COMM_WORLD, 3, grid, periods, 0, &CART_COMM); //communicator creation
+    MPI_Cart_coords(CART_COMM, rank, 3, rank_grid);                 //rank mapping on the new communicator
+
+    //----Compute local 3D-subdomain dimensions----//
+    //----If the 3D-domain cannot be equally distributed, the first processes get a plane more----//
+
+    for (i = 0; i < 3; i++)
+        {
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
+        }
+
+    //Halo exchange backend
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
+        {
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
+        }
+
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
+        {
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
+        }
+    hints = output_hints(argc, argv);
+
+    //every=n tests every n iterations, every=auto (the default) places each test
+    //where the decay of the update norm predicts convergence, cmin to cmax apart
+    sched_init(&sched, strcmp(option_str(argc, argv, "every", "auto"), "auto") == 0 ? 0 : option_int(argc, argv, "every", C), \
+               option_int(argc, argv, "cmin", C / 10), option_int(argc, argv, "cmax", 10 * C));
+
+#   ifdef REDBLACK
+    //Optimum SOR factor for the Jacobi spectral radius of the 7-point Laplacian
+    //on this grid, the mean of the three 1D ones; omega=w fixes it
+    omega = sor_omega((cos(M_PI / (global[0] - 1)) + cos(M_PI / (global[1] - 1)) + cos(M_PI / (global[2] - 1))) / 3);
+    if (strcmp(option_str(argc, argv, "omega", "auto"), "auto") != 0)
+        omega = atof(option_str(argc, argv, "omega", "auto"));
+#   endif
+
+    //----Allocate local 3D-subdomains with a ghost layer on each side----//
+    //----Colours follow the global index so they match across processes----//
+
+    u_local = allocate3d(local[0], local[1], local[2], 1);
+#   ifdef JACOBI
+    u_previous = allocate3d(local[0], local[1], local[2], 1);
+    u_current = u_local;
+#   endif
+#   ifdef REDBLACK
+    int shift = (offset[0] + offset[1] + offset[2]) & 1;
+    u_rb = allocate_rb3d(local[0], local[1], local[2], 1, shift);
+#   endif
+
+    //----Every process initializes the interior of its own block from its global position----//
+
+    init_block3d(u_local, offset[0], offset[1], offset[2]);
+#   ifdef JACOBI
+    memcpy(u_previous->base, u_current->base, u_current->dimX * u_current->plane * sizeof(double));
+#   endif
+#   ifdef REDBLACK
+    split_rb3d(u_local, u_rb);
+#   endif
+
+    //----Find the 6 neighbors with which a process exchanges messages----//
+    //Indexed by side, -1 where the domain ends
+
+    int peer[HALO_SIDES];
+    for (i = 0; i < 3; i++)
+        {
+            MPI_Cart_shift(CART_COMM, i, 1, &peer[2 * i], &peer[2 * i + 1]);
+            for (j = 2 * i; j < 2 * i + 2; j++)
+                if (peer[j] == MPI_PROC_NULL)
+                    peer[j] = -1;
+        }
+
+    //---Define the iteration ranges per process-----//
+    //Boundary processes keep their boundary plane fixed
+
+    int i_min, i_max, j_min, j_max, l_min, l_max;
+    i_min = (peer[HALO_NORTH] == -1) ? 2 : 1;
+    i_max = local[0] + 1 - ((peer[HALO_SOUTH] == -1) ? 1 : 0);
+    j_min = (peer[HALO_WEST] == -1) ? 2 : 1;
+    j_max = local[1] + 1 - ((peer[HALO_EAST] == -1) ? 1 : 0);
+    l_min = (peer[HALO_FRONT] == -1) ? 2 : 1;
+    l_max = local[2] + 1 - ((peer[HALO_BACK] == -1) ? 1 : 0);
+
+    printf("Process (%d, %d, %d) R: %2d Neighbors: N: %2d S: %2d W: %2d E: %2d F: %2d B: %2d Working Size: %d x %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d, Lmin %d, Lmax %d\n", \
+           rank_grid[0], rank_grid[1], rank_grid[2], rank, peer[0], peer[1], peer[2], peer[3], peer[4], peer[5], \
+           u_local->dimX, u_local->dimY, u_local->dimZ, i_min, i_max, j_min, j_max, l_min, l_max);
+
+    //----Halo exchange, built once per buffer----//
+    //Jacobi exchanges the buffer it reads, red-black each colour once it is updated
+    MPI_Datatype face[3];
+#   ifdef JACOBI
+    halo2d halos[2], * halo;
+    grid3d * halo_grid[2] = {u_previous, u_current};
+    FaceTypes(u_previous, local[0], local[1], local[2], 0, face);
+    for (i = 0; i < 2; i++)
+        FaceHalo(&halos[i], CART_COMM, nbr, halo_grid[i], 0, 0, peer, i_max, j_max, l_max, face);
+#   endif
+#   ifdef REDBLACK
+    halo2d halo_red, halo_black;
+    FaceTypes(u_rb->red, local[0], local[1], local[2], 1, face);
+    FaceHalo(&halo_red, CART_COMM, nbr, u_rb->red, 1, shift, peer, i_max, j_max, l_max, face);
+    FaceHalo(&halo_black, CART_COMM, nbr, u_rb->black, 1, shift + 1, peer, i_max, j_max, l_max, face);
+#   endif
+
+    //----Computational core----//
+    gettimeofday(&tts, NULL); //Get Starting Time
+
+#   ifdef TEST_CONV
+    for (t = 0; t < T && !global_converged; t++)
+        {
+#   endif
+#   ifndef TEST_CONV
+#   undef T
+#   define T 65536
+            for (t = 0; t < T; t++)
+                {
+#   endif
+
+#               ifdef TEST_CONV
+                    check = sched_due(&sched, t);
+#               endif
+                    res = 0;
+                    tsweep = 0;
+
+#               ifdef JACOBI
+                    //Swap Buffers
+                    swap = u_previous;
+                    u_previous = u_current;
+                    u_current = swap;
+                    //Communicate
+                    halo = (u_previous == halo_grid[0]) ? &halos[0] : &halos[1];
+                    tw0 = MPI_Wtime();
+                    halo_exchange(halo);
+                    tcomm += MPI_Wtime() - tw0;
+
+                    tc0 = MPI_Wtime();
+                    Jacobi(u_previous, u_current, i_min, i_max, j_min, j_max, l_min, l_max, check ? &res : NULL);
+                    tsweep += MPI_Wtime() - tc0;
+#               endif
+
+#               ifdef REDBLACK
+                    //Red reads the black halo of the last iteration, black the red one just updated
+                    tw0 = MPI_Wtime();
+                    halo_exchange(&halo_black);
+                    tcomm += MPI_Wtime() - tw0;
+                    tc0 = MPI_Wtime();
+                    ColourSOR(u_rb->red, u_rb->black, shift, i_min, i_max, j_min, j_max, l_min, l_max, omega, check ? &res : NULL);
+                    tsweep += MPI_Wtime() - tc0;
+                    tw0 = MPI_Wtime();
+                    halo_exchange(&halo_red);
+                    tcomm += MPI_Wtime() - tw0;
+                    tc0 = MPI_Wtime();
+                    ColourSOR(u_rb->black, u_rb->red, shift + 1, i_min, i_max, j_min, j_max, l_min, l_max, omega, check ? &res : NULL);
+                    tsweep += MPI_Wtime() - tc0;
+#               endif
+
+                    //Calculate Computation Time,  Average
+                    tcomp = (tcomp + tsweep) / 2.;
+                    tkernel += tsweep;
+
+#               ifdef TEST_CONV
+                    if (check)
+                        {
+                            //Same test as converge(): no point moved by more than e
+                            converged = (res <= e);
+                            if (converged)
+                                printf("Process: %d Converged\n", rank);
+                            //The global norm, not just the flag, so that every process
+                            //schedules the next test at the same iteration
+                            sched_start(&sched, t);
+                            MPI_Allreduce(&res, &conv_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                            sched_update(&sched, t, conv_global);
+                            global_converged = (conv_global <= e);
+                        }
+#               endif
+                }
+            printf("Rank: %d,  Done Computing\n", rank);
+            gettimeofday(&ttf, NULL);
+
+            ttotal = (ttf.tv_sec - tts.tv_sec) + (ttf.tv_usec - tts.tv_usec) * 0.000001;
+
+            MPI_Barrier(MPI_COMM_WORLD); //Make sure all processes have finished computation
+
+            MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomm, &comm_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            //Jacobi: 5 additions and 1 multiplication per point, a colour update 5 more
+            flops = (double)(i_max - i_min) * (j_max - j_min) * (l_max - l_min) * t;
+#           ifdef JACOBI
+            flops *= 6;
+#           endif
+#           ifdef REDBLACK
+            flops *= 11;
+#           endif
+            MPI_Reduce(&flops, &total_flops, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tkernel, &kernel_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+            //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
+            if (rank == 0)
+                {
+                    U = allocate3d(global[0], global[1], global[2], 0);
+                }
+#           ifdef JACOBI
+            if (!binary)
+                gather3d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
+#           endif
+#           ifdef REDBLACK
+            merge_rb3d(u_rb, u_local);
+            if (!binary)
+                gather3d((rank == 0) ? U : NULL, u_local, global, CART_COMM);
+#           endif
+
+            //----Printing results----//
+
+#           ifdef PRINT_RESULTS
+            char * s = malloc(64 * sizeof(char));
+#           ifdef JACOBI
+            double midpoint = probe3d(u_current, offset, global[0] / 2, global[1] / 2, global[2] / 2, CART_COMM);
+#           endif
+#           ifdef REDBLACK
+            double midpoint = probe3d(u_local, offset, global[0] / 2, global[1] / 2, global[2] / 2, CART_COMM);
+#           endif
+#           endif
+
+            if (rank == 0)
+                {
+#           ifdef PRINT_RESULTS
+#           ifdef JACOBI
+                    printf("Jacobi3D X %d Y %d Z %d Px %d Py %d Pz %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf GFlops %lf CommTime %lf Halo %s\n", \
+                           global[0], global[1], global[2], grid[0], grid[1], grid[2], threads, t, comp_time, total_time, midpoint, \
+                           total_flops / kernel_time * 1e-9, comm_time / size, nbr ? "nbr" : "p2p");
+                    sprintf(s, "res%sMPI_%dx%dx%d_%dx%dx%d", "Jacobi3D", global[0], global[1], global[2], grid[0], grid[1], grid[2]);
+#           endif
+
+#           ifdef REDBLACK
+                    printf("RedBlackSOR3D X %d Y %d Z %d Px %d Py %d Pz %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf GFlops %lf Omega %lf CommTime %lf Halo %s\n", \
+                           global[0], global[1], global[2], grid[0], grid[1], grid[2], threads, t, comp_time, total_time, midpoint, \
+                           total_flops / kernel_time * 1e-9, omega, comm_time / size, nbr ? "nbr" : "p2p");
+                    sprintf(s, "res%sMPI_%dx%dx%d_%dx%dx%d", "RedBlackSOR3D", global[0], global[1], global[2], grid[0], grid[1], grid[2]);
+#           endif
+
+                    if (binary)
+                        strcat(s, ".bin");
+                    else
+                        fprint3d(s, U, global[0], global[1], global[2]);
+#           endif
+#           ifdef TEST_CONV
+                    printf("Convergence sync Every %d Checks %d Wasted %d\n", sched.every, sched.checks, sched.wasted);
+#           endif
+                    if (!binary)
+                        free3d(U);
+                }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                {
+#           ifdef JACOBI
+                    write3d(s, u_current, offset, global, hints, CART_COMM);
+#           endif
+#           ifdef REDBLACK
+                    write3d(s, u_local, offset, global, hints, CART_COMM);
+#           endif
+                }
+            free(s);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+#           ifdef JACOBI
+            halo_free(&halos[0]);
+            halo_free(&halos[1]);
+#           endif
+#           ifdef REDBLACK
+            halo_free(&halo_red);
+            halo_free(&halo_black);
+#           endif
+            MPI_Finalize();
+            return 0;
+
+        }
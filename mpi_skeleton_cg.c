@@ -0,0 +1,567 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "mpi.h"
+#include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//Computational Kernels
+//The interior points solve A u = b, A u = 4 u - (north + south + west + east)
+//with the boundary values moved into b. A is symmetric positive definite, so
+//conjugate gradients apply it matrix-free: every product is one 5-point sweep
+//over a vector whose ghost layer was just exchanged, and whose boundary points
+//stay 0. Dot products only run over the interior points of each process
+
+//r = b - A u, reading the boundary values of u
+void Residual(grid2d * u, grid2d * r, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+#   pragma omp parallel for private(j) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            G(r, i, j) = G(u, i - 1, j) + G(u, i + 1, j) + G(u, i, j - 1) + G(u, i, j + 1) - 4 * G(u, i, j);
+}
+
+//Local part of (a, b)
+double Dot(grid2d * a, grid2d * b, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+    double dot = 0;
+#   pragma omp parallel for private(j) reduction(+:dot) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            dot += G(a, i, j) * G(b, i, j);
+    return dot;
+}
+
+//q = A p, returns the local part of (p, q)
+double Laplace(grid2d * p, grid2d * q, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+    double dot = 0;
+    const int s = p->stride;
+    const double * restrict pc = p->data;
+    double * restrict qc = q->data;
+#   pragma omp parallel for private(j) reduction(+:dot) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            {
+                qc[i * s + j] = 4 * pc[i * s + j] - (pc[(i - 1) * s + j] + pc[(i + 1) * s + j] + pc[i * s + j - 1] + pc[i * s + j + 1]);
+                dot += pc[i * s + j] * qc[i * s + j];
+            }
+    return dot;
+}
+
+//w = A r, with the local parts of (r, r) and (w, r) in dots
+void LaplaceDots(grid2d * r, grid2d * w, int X_min, int X_max, int Y_min, int Y_max, double * dots)
+{
+    int i, j;
+    double rr = 0, wr = 0;
+    const int s = r->stride;
+    const double * restrict rc = r->data;
+    double * restrict wc = w->data;
+#   pragma omp parallel for private(j) reduction(+:rr, wr) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            {
+                wc[i * s + j] = 4 * rc[i * s + j] - (rc[(i - 1) * s + j] + rc[(i + 1) * s + j] + rc[i * s + j - 1] + rc[i * s + j + 1]);
+                rr += rc[i * s + j] * rc[i * s + j];
+                wr += wc[i * s + j] * rc[i * s + j];
+            }
+    dots[0] = rr;
+    dots[1] = wr;
+}
+
+//Classic CG step: u += alpha p, r -= alpha q, returns the local part of (r, r)
+double UpdateClassic(grid2d * u, grid2d * r, grid2d * p, grid2d * q, double alpha, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+    double rr = 0;
+#   pragma omp parallel for private(j) reduction(+:rr) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            {
+                G(u, i, j) += alpha * G(p, i, j);
+                G(r, i, j) -= alpha * G(q, i, j);
+                rr += G(r, i, j) * G(r, i, j);
+            }
+    return rr;
+}
+
+//p = r + beta p
+void Direction(grid2d * r, grid2d * p, double beta, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+#   pragma omp parallel for private(j) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            G(p, i, j) = G(r, i, j) + beta * G(p, i, j);
+}
+
+//Chronopoulos/Gear step: s = A p follows from w = A r by the same recurrence
+//p = r + beta p, s = w + beta s, u += alpha p, r -= alpha s
+void UpdateFused(grid2d * u, grid2d * r, grid2d * w, grid2d * p, grid2d * s, double alpha, double beta, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+#   pragma omp parallel for private(j) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            {
+                G(p, i, j) = G(r, i, j) + beta * G(p, i, j);
+                G(s, i, j) = G(w, i, j) + beta * G(s, i, j);
+                G(u, i, j) += alpha * G(p, i, j);
+                G(r, i, j) -= alpha * G(s, i, j);
+            }
+}
+
+//Pipelined step (Ghysels and Vanroose): w = A r and z = A s are also carried
+//by recurrences, so the only product, q = A w, overlaps the reduction
+//z = q + beta z, s = w + beta s, p = r + beta p, u += alpha p, r -= alpha s,
+//w -= alpha z, with the local parts of the next (r, r) and (w, r) in dots
+void UpdatePipelined(grid2d * u, grid2d * r, grid2d * w, grid2d * p, grid2d * s, grid2d * z, grid2d * q, double alpha, double beta, int X_min, int X_max, int Y_min, int Y_max, double * dots)
+{
+    int i, j;
+    double rr = 0, wr = 0;
+#   pragma omp parallel for private(j) reduction(+:rr, wr) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            {
+                G(z, i, j) = G(q, i, j) + beta * G(z, i, j);
+                G(s, i, j) = G(w, i, j) + beta * G(s, i, j);
+                G(p, i, j) = G(r, i, j) + beta * G(p, i, j);
+                G(u, i, j) += alpha * G(p, i, j);
+                G(r, i, j) -= alpha * G(s, i, j);
+                G(w, i, j) -= alpha * G(z, i, j);
+                rr += G(r, i, j) * G(r, i, j);
+                wr += G(w, i, j) * G(r, i, j);
+            }
+    dots[0] = rr;
+    dots[1] = wr;
+}
+
+//Persistent halo of one vector, no corners: the stencil has none
+void VectorHalo(halo2d * h, MPI_Comm comm, int nbr, grid2d * g, int X, int Y, int north, int south, int east, int west, MPI_Datatype mat_row, MPI_Datatype mat_column)
+{
+    halo_init(h, comm, nbr);
+    halo_side(h, HALO_NORTH, &G(g, 1, 1), &G(g, 0, 1), mat_row, north);
+    halo_side(h, HALO_SOUTH, &G(g, X, 1), &G(g, X + 1, 1), mat_row, south);
+    halo_side(h, HALO_WEST, &G(g, 1, 1), &G(g, 1, 0), mat_column, west);
+    halo_side(h, HALO_EAST, &G(g, 1, Y), &G(g, 1, Y + 1), mat_column, east);
+}
+
+
+int main(int argc, char ** argv)
+{
+    int rank, size;
+    int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
+    int grid[2];            //processor grid dimensions
+    int i, t;
+    int global_converged = 0; //flag for convergence
+    MPI_Datatype dummy;     //dummy datatype used to align user-defined datatypes in memory
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    int variant;            //0 classic CG, 1 Chronopoulos/Gear, 2 pipelined
+    int reductions = 0;     //global reductions started
+    double alpha = 0, beta = 0, gamma, gamma_old = 0, delta, pq; //CG scalars
+    double dots[2], sums[2]; //local and global (r, r) and (w, r)
+    MPI_Request red_req;
+
+    struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
+    double ttotal = 0, tcomp = 0, total_time, comp_time;
+    double tw0, tcomm = 0, comm_time; //Time spent in halo exchanges
+    double tr0, tred = 0, red_time;   //Time spent in (or waiting for) the reductions
+
+    grid2d * U, * u_current, * r, * p, * q, * w = NULL, * s = NULL, * z = NULL; //Global matrix, solution and CG vectors
+
+
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
+    MPI_Init(&argc, &argv);
+#   endif
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    //----Read 2D-domain dimensions and process grid dimensions from stdin----//
+
+    if (argc < 5)
+        {
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [cg=classic|fused|pipelined] [halo=p2p|nbr] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
+            exit(-1);
+        }
+    else
+        {
+            global[0] = atoi(argv[1]);
+            global[1] = atoi(argv[2]);
+            grid[0] = atoi(argv[3]);
+            grid[1] = atoi(argv[4]);
+        }
+
+    //----Create 2D-cartesian communicator----//
+    //----Usage of the cartesian communicator is optional----//
+
+    MPI_Comm CART_COMM;         //CART_COMM: the new 2D-cartesian communicator
+    int periods[2] = {0, 0};    //periods={0,0}: the 2D-grid is non-periodic
+    int rank_grid[2];           //rank_grid: the position of each process on the new communicator
+
+    MPI_Cart_create(MPI_COMM_WORLD, 2, grid, periods, 0, &CART_COMM); //communicator creation
+    MPI_Cart_coords(CART_COMM, rank, 2, rank_grid);                 //rank mapping on the new communicator
+
+    MPI_Barrier(CART_COMM);
+    MPI_Barrier(MPI_COMM_WORLD);
+    //----Compute local 2D-subdomain dimensions----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
+
+    for (i = 0; i < 2; i++)
+        {
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
+        }
+
+    //cg=classic reduces twice per iteration, cg=fused (Chronopoulos/Gear) once,
+    //cg=pipelined once with MPI_Iallreduce, overlapped with the operator product
+    variant = strcmp(option_str(argc, argv, "cg", "classic"), "fused") == 0 ? 1 : strcmp(option_str(argc, argv, "cg", "classic"), "pipelined") == 0 ? 2 : 0;
+    if (!variant && strcmp(option_str(argc, argv, "cg", "classic"), "classic") != 0)
+        {
+            fprintf(stderr, "cg must be classic, fused or pipelined\n");
+            exit(-1);
+        }
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
+        {
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
+        }
+
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
+        {
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
+        }
+    hints = output_hints(argc, argv);
+
+
+    //----Allocate local 2D-subdomain u_current and the CG vectors----//
+    //----Add a row/column on each size for ghost cells----//
+
+    u_current = allocate2d(local[0], local[1], 1);
+    r = allocate2d(local[0], local[1], 1);
+    p = allocate2d(local[0], local[1], 1);
+    q = allocate2d(local[0], local[1], 1);
+    if (variant)
+        {
+            w = allocate2d(local[0], local[1], 1);
+            s = allocate2d(local[0], local[1], 1);
+        }
+    if (variant == 2)
+        z = allocate2d(local[0], local[1], 1);
+
+    //----Every process initializes the interior of its own block from its global position----//
+
+    init_block2d(u_current, offset[0], offset[1]);
+
+    //----Define datatypes or allocate buffers for message passing----//
+
+    MPI_Datatype mat_row;
+    MPI_Type_contiguous(local[1], MPI_DOUBLE, &mat_row);
+    MPI_Type_commit(&mat_row);
+
+    MPI_Datatype mat_column;
+    MPI_Type_vector(local[0], 1, u_current->stride, MPI_DOUBLE, &dummy);
+    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
+    MPI_Type_commit(&mat_column);
+
+    //----Find the 4 neighbors with which a process exchanges messages----//
+
+    int north, south, east, west;
+    north = -1;
+    south = -1;
+    east = -1;
+    west = -1;
+
+    //Try to get north Process
+    if (rank_grid[0] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0] - 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos , &north);
+        }
+
+    //Try to get south Process
+    if (rank_grid[0] + 1 <= grid[0] - 1)
+        {
+            int npos[2] = {rank_grid[0] + 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos, &south);
+        }
+
+    //Try to get east Process
+    if (rank_grid[1] + 1 <= grid[1] - 1)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] + 1};
+            MPI_Cart_rank(CART_COMM, npos, &east);
+        }
+
+    //Try to get west Process
+    if (rank_grid[1] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] - 1};
+            MPI_Cart_rank(CART_COMM, npos, &west);
+        }
+
+
+    //---Define the iteration ranges per process-----//
+
+    int i_min, i_max, j_min, j_max;
+
+    /*Two types of ranges over the local[0] x local[1] block (block_size):
+        -internal processes
+        -boundary processes, whose first or last row or column is the global boundary
+    */
+
+    //Init Values for internal processes
+    i_min = 1;
+    i_max = local[0] + 1;
+
+    j_min = 1;
+    j_max = local[1] + 1;
+
+
+    //Fix stuff according to neighbors found
+    //This Should fix Boundary Processes
+    if (north == -1)
+        {
+            i_min += 1;
+        }
+    if (south == -1)
+        {
+            i_max -= 1;
+        }
+    if (west == -1)
+        {
+            j_min += 1;
+        }
+    if (east == -1)
+        {
+            j_max -= 1;
+        }
+
+
+
+    printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
+           rank_grid[0], rank_grid[1], rank,  north, south, east, west, local[0] + 2, local[1] + 2, i_min, i_max, j_min, j_max);
+
+    //----Persistent halo exchanges: u once, then the vector A is applied to----//
+    //classic: p, fused: r, pipelined: w
+    halo2d halo_u, halo;
+    VectorHalo(&halo_u, CART_COMM, nbr, u_current, local[0], local[1], north, south, east, west, mat_row, mat_column);
+    VectorHalo(&halo, CART_COMM, nbr, (variant == 0) ? p : (variant == 1) ? r : w, local[0], local[1], north, south, east, west, mat_row, mat_column);
+
+    //----Computational core----//
+    gettimeofday(&tts, NULL); //Get Starting Time
+
+    //Initial residual, and for the one-reduction variants w = A r with the
+    //dot products of the first iteration
+    halo_exchange(&halo_u);
+    halo_free(&halo_u);
+    Residual(u_current, r, i_min, i_max, j_min, j_max);
+    if (variant == 0)
+        dots[0] = Dot(r, r, i_min, i_max, j_min, j_max);
+    else
+        {
+            tw0 = MPI_Wtime();
+            if (variant == 1)
+                halo_exchange(&halo);
+            else
+                {
+                    //w is not exchanged yet, r is
+                    halo2d halo_r;
+                    VectorHalo(&halo_r, CART_COMM, nbr, r, local[0], local[1], north, south, east, west, mat_row, mat_column);
+                    halo_exchange(&halo_r);
+                    halo_free(&halo_r);
+                }
+            tcomm += MPI_Wtime() - tw0;
+            LaplaceDots(r, w, i_min, i_max, j_min, j_max, dots);
+        }
+
+#   ifdef TEST_CONV
+    for (t = 0; t < T && !global_converged; t++)
+        {
+#   endif
+#   ifndef TEST_CONV
+#   undef T
+#   define T 1024
+            for (t = 0; t < T; t++)
+                {
+#   endif
+
+                    //Start Computation
+                    /*Add appropriate timers for computation*/
+                    gettimeofday(&tcs, NULL);
+                    tw0 = tcomm;
+                    tr0 = tred;
+
+                    //Computational Kernels
+                    if (variant == 0)
+                        {
+                            //gamma = (r, r) from the last update, alpha = gamma / (p, A p)
+                            red_time = MPI_Wtime();
+                            MPI_Allreduce(dots, &gamma, 1, MPI_DOUBLE, MPI_SUM, CART_COMM);
+                            tred += MPI_Wtime() - red_time;
+                            reductions++;
+                            global_converged = (sqrt(gamma) <= 4 * e);
+                            if (!global_converged)
+                                {
+                                    beta = (t > 0) ? gamma / gamma_old : 0;
+                                    Direction(r, p, beta, i_min, i_max, j_min, j_max);
+                                    comm_time = MPI_Wtime();
+                                    halo_exchange(&halo);
+                                    tcomm += MPI_Wtime() - comm_time;
+                                    dots[1] = Laplace(p, q, i_min, i_max, j_min, j_max);
+                                    red_time = MPI_Wtime();
+                                    MPI_Allreduce(&dots[1], &pq, 1, MPI_DOUBLE, MPI_SUM, CART_COMM);
+                                    tred += MPI_Wtime() - red_time;
+                                    reductions++;
+                                    alpha = gamma / pq;
+                                    dots[0] = UpdateClassic(u_current, r, p, q, alpha, i_min, i_max, j_min, j_max);
+                                    gamma_old = gamma;
+                                }
+                        }
+                    else
+                        {
+                            //One reduction of (r, r) and (w, r) per iteration
+                            red_time = MPI_Wtime();
+                            if (variant == 1)
+                                MPI_Allreduce(dots, sums, 2, MPI_DOUBLE, MPI_SUM, CART_COMM);
+                            else
+                                {
+                                    MPI_Iallreduce(dots, sums, 2, MPI_DOUBLE, MPI_SUM, CART_COMM, &red_req);
+                                    tred += MPI_Wtime() - red_time;
+                                    //q = A w while the reduction travels
+                                    comm_time = MPI_Wtime();
+                                    halo_exchange(&halo);
+                                    tcomm += MPI_Wtime() - comm_time;
+                                    Laplace(w, q, i_min, i_max, j_min, j_max);
+                                    red_time = MPI_Wtime();
+                                    MPI_Wait(&red_req, MPI_STATUS_IGNORE);
+                                }
+                            tred += MPI_Wtime() - red_time;
+                            reductions++;
+                            gamma = sums[0];
+                            delta = sums[1];
+                            global_converged = (sqrt(gamma) <= 4 * e);
+                            if (!global_converged)
+                                {
+                                    beta = (t > 0) ? gamma / gamma_old : 0;
+                                    alpha = (t > 0) ? gamma / (delta - beta * gamma / alpha) : gamma / delta;
+                                    gamma_old = gamma;
+                                    if (variant == 1)
+                                        {
+                                            UpdateFused(u_current, r, w, p, s, alpha, beta, i_min, i_max, j_min, j_max);
+                                            comm_time = MPI_Wtime();
+                                            halo_exchange(&halo);
+                                            tcomm += MPI_Wtime() - comm_time;
+                                            LaplaceDots(r, w, i_min, i_max, j_min, j_max, dots);
+                                        }
+                                    else
+                                        UpdatePipelined(u_current, r, w, p, s, z, q, alpha, beta, i_min, i_max, j_min, j_max, dots);
+                                }
+                        }
+
+                    gettimeofday(&tcf, NULL);
+                    tcomp = (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - (tcomm - tw0) - (tred - tr0)) / 2.;
+
+#               ifdef TEST_CONV
+                    //*************TODO**************//
+                    /*Test convergence*/
+                    //Folded into the reduction: ||r||_2 <= 4 e bounds the max-norm of
+                    //the residual, so a Jacobi sweep would move no point by more than e
+#               endif
+
+                    //************************************//
+
+                }
+            printf("Rank: %d,  Done Computing\n", rank);
+            gettimeofday(&ttf, NULL);
+
+            ttotal = (ttf.tv_sec - tts.tv_sec) + (ttf.tv_usec - tts.tv_usec) * 0.000001;
+
+            MPI_Barrier(MPI_COMM_WORLD); //Make sure all processes have finished computation
+
+            //The following reduction is for the time sum
+            MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomm, &comm_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tred, &red_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+
+
+            //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
+            if (rank == 0)
+                {
+                    U = binary ? NULL : allocate2d(global[0], global[1], 0);
+                    printf("Value of T : %d\n", T);
+                }
+
+
+            //All Processes send data back to rank0,  rank0 receives
+            //Every block is received into its place by a subarray datatype
+            if (!binary)
+                gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
+
+
+            //************************************//
+
+            //----Printing results----//
+
+#           ifdef PRINT_RESULTS
+            char * name = malloc(50 * sizeof(char));
+            double midpoint = probe2d(u_current, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#           endif
+
+            if (rank == 0)
+                {
+
+#           ifdef PRINT_RESULTS
+#           ifdef CG
+                    //AllreduceTime: slowest process, in total and per iteration
+                    printf("ConjugateGradient X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Variant %s Reductions %d AllreduceTime %lf PerIteration %e CommTime %lf Halo %s\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, \
+                           variant == 2 ? "pipelined" : variant ? "fused" : "classic", reductions, red_time, red_time / t, comm_time / size, nbr ? "nbr" : "p2p");
+                    sprintf(name, "res%sMPI_%dx%d_%dx%d", "ConjugateGradient", global[0], global[1], grid[0], grid[1]);
+#           endif
+
+                    if (binary)
+                        strcat(name, ".bin");
+                    else
+                        fprint2d(name, U, global[0], global[1]);
+#           endif
+
+                }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                write2d(name, u_current, offset, global, hints, CART_COMM);
+            free(name);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+            halo_free(&halo);
+            MPI_Finalize();
+            return 0;
+
+        }
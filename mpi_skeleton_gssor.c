@@ -5,41 +5,56 @@
 #include <sys/time.h>
 #include "mpi.h"
 #include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#include "stencil.h"
 
 //Computational Kernels
 
-void Jacobi(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max)
+void Jacobi(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1]) / 4.0;
+            uc[i * s + j] = STENCIL5(up, up, s, i * s + j);
 }
 
-void GaussSeidel(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+void GaussSeidel(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = u_previous[i][j] + (u_current[i - 1][j] + u_previous[i + 1][j] + u_current[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]) * omega / 4.0;
+            uc[i * s + j] = up[i * s + j] + omega * (STENCIL5(uc, up, s, i * s + j) - up[i * s + j]);
 }
 
-void RedSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+void RedSOR(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
             if ((i + j) % 2 == 0)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]);
+                uc[i * s + j] = up[i * s + j] + omega * (STENCIL5(up, up, s, i * s + j) - up[i * s + j]);
 }
 
-void BlackSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+void BlackSOR(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
 {
     int i, j;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
             if ((i + j) % 2 == 1)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_current[i - 1][j] + u_current[i + 1][j] + u_current[i][j - 1] + u_current[i][j + 1] - 4 * u_previous[i][j]);
+                uc[i * s + j] = up[i * s + j] + omega * (STENCIL5(uc, uc, s, i * s + j) - up[i * s + j]);
 }
 
 
@@ -47,17 +62,25 @@ int main(int argc, char ** argv)
 {
     int rank, size;
     int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
-    int global_padded[2];   //padded global matrix dimensions (if padding is not needed, global_padded=global)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
     int grid[2];            //processor grid dimensions
-    int i, j, t;
+    int i, t;
     int global_converged = 0, converged = 0; //flags for convergence, global and per process
     MPI_Datatype dummy;     //dummy datatype used to align user-defined datatypes in memory
     double omega;           //relaxation factor - useless for Jacobi
+    int omega_auto;         //omega from a Jacobi estimate of the spectral radius
+    int estimate;           //Jacobi sweeps of the estimate
+    int refine;             //raise omega from the decay seen by the convergence tests
+    double omega_start;     //omega the iterations started with
+    double global_res;      //update norm of a convergence test over all processes
+    conv_sched sched;       //when to test: every C iterations or adaptive
 
     struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
     double ttotal = 0, tcomp = 0, total_time, comp_time;
 
-    double ** U, ** u_current, ** u_previous, ** swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
+    grid2d * U, * u_current, * u_previous, * swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
 
 
     MPI_Init(&argc, &argv);
@@ -66,9 +89,9 @@ int main(int argc, char ** argv)
 
     //----Read 2D-domain dimensions and process grid dimensions from stdin----//
 
-    if (argc != 5)
+    if (argc < 5)
         {
-            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py \n");
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [every=auto|iters] [cmin=iters] [cmax=iters] [omega=auto|w] [estimate=sweeps] [refine=0|1] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
             exit(-1);
         }
     else
@@ -79,6 +102,11 @@ int main(int argc, char ** argv)
             grid[1] = atoi(argv[4]);
         }
 
+    //every=n tests every n iterations, every=auto (the default) places each test
+    //where the decay of the update norm predicts convergence, cmin to cmax apart
+    sched_init(&sched, strcmp(option_str(argc, argv, "every", "auto"), "auto") == 0 ? 0 : option_int(argc, argv, "every", C), \
+               option_int(argc, argv, "cmin", C / 10), option_int(argc, argv, "cmax", 10 * C));
+
     //----Create 2D-cartesian communicator----//
     //----Usage of the cartesian communicator is optional----//
 
@@ -92,86 +120,42 @@ int main(int argc, char ** argv)
     MPI_Barrier(CART_COMM);
     MPI_Barrier(MPI_COMM_WORLD);
     //----Compute local 2D-subdomain dimensions----//
-    //----Test if the 2D-domain can be equally distributed to all processes----//
-    //----If not, pad 2D-domain----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
 
     for (i = 0; i < 2; i++)
         {
-            if (global[i] % grid[i] == 0)
-                {
-                    local[i] = global[i] / grid[i];
-                    global_padded[i] = global[i];
-                }
-            else
-                {
-                    local[i] = (global[i] / grid[i]) + 1;
-                    global_padded[i] = local[i] * grid[i];
-                }
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
         }
 
-    //Initialization of omega
-    omega = 2.0 / (1 + sin(3.14 / global[0]));
-
-
-    //----Allocate global 2D-domain and initialize boundary values----//
-    //----Rank 0 holds the global 2D-domain----//
-    if (rank == 0)
+    //Initialization of omega: omega=auto (the default) sets the optimum for the
+    //spectral radius measured by estimate= Jacobi sweeps, omega=w fixes it
+    omega_auto = strcmp(option_str(argc, argv, "omega", "auto"), "auto") == 0;
+    omega = omega_auto ? 1.0 : atof(option_str(argc, argv, "omega", "auto"));
+    estimate = option_int(argc, argv, "estimate", 50);
+    if (estimate < 2)
+        estimate = 2;
+    refine = option_int(argc, argv, "refine", omega_auto);
+
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
         {
-            U = allocate2d(global_padded[0], global_padded[1]);
-            init2d(U, global[0], global[1]);
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
         }
+    hints = output_hints(argc, argv);
+
 
     //----Allocate local 2D-subdomains u_current, u_previous----//
     //----Add a row/column on each size for ghost cells----//
 
-    u_previous = allocate2d(local[0] + 2, local[1] + 2);
-    u_current = allocate2d(local[0] + 2, local[1] + 2);
-
-    //----Distribute global 2D-domain from rank 0 to all processes----//
-
-    //----Appropriate datatypes are defined here----//
-    /*****The usage of datatypes is optional*****/
-
-    //----Datatype definition for the 2D-subdomain on the global matrix----//
-
-    MPI_Datatype global_block;
-    MPI_Type_vector(local[0], local[1], global_padded[1], MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &global_block);
-    MPI_Type_commit(&global_block);
+    u_previous = allocate2d(local[0], local[1], 1);
+    u_current = allocate2d(local[0], local[1], 1);
 
-    //----Datatype definition for the 2D-subdomain on the local matrix----//
+    //----Every process initializes the interior of its own block from its global position----//
 
-    MPI_Datatype local_block;
-    MPI_Type_vector(local[0], local[1], local[1] + 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &local_block);
-    MPI_Type_commit(&local_block);
-
-    //----Rank 0 defines positions and counts of local blocks (2D-subdomains) on global matrix----//
-    int * scatteroffset, * scattercounts;
-    if (rank == 0)
-        {
-            scatteroffset = (int*)malloc(size * sizeof(int));
-            scattercounts = (int*)malloc(size * sizeof(int));
-            for (i = 0; i < grid[0]; i++)
-                for (j = 0; j < grid[1]; j++)
-                    {
-                        scattercounts[i * grid[1] + j] = 1;
-                        scatteroffset[i * grid[1] + j] = (local[0] * local[1] * grid[1] * i + local[1] * j);
-                    }
-        }
-
-
-    //----Rank 0 scatters the global matrix----//
-
-    double * initaddr;
-    if (rank == 0)
-        initaddr = &(U[0][0]);
-
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_previous[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_current[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
-
-    if (rank == 0)
-        free2d(U, global_padded[0], global_padded[1]);
+    init_block2d(u_previous, offset[0], offset[1]);
+    init_block2d(u_current, offset[0], offset[1]);
 
     //----Define datatypes or allocate buffers for message passing----//
     MPI_Datatype mat_row;
@@ -180,7 +164,7 @@ int main(int argc, char ** argv)
     MPI_Type_commit(&mat_row);
 
     MPI_Datatype mat_column;
-    MPI_Type_vector(local[0], 1, local[1] + 2, MPI_DOUBLE, &dummy);
+    MPI_Type_vector(local[0], 1, u_previous->stride, MPI_DOUBLE, &dummy);
     MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
     MPI_Type_commit(&mat_column);
 
@@ -236,10 +220,9 @@ int main(int argc, char ** argv)
 
     int i_min, i_max, j_min, j_max;
 
-    /*Three types of ranges:
+    /*Two types of ranges over the local[0] x local[1] block (block_size):
         -internal processes
-        -boundary processes
-        -boundary processes and padded global array
+        -boundary processes, whose first or last row or column is the global boundary
     */
 
     //Init Values for internal processes
@@ -269,17 +252,6 @@ int main(int argc, char ** argv)
             j_max -= 1;
         }
 
-    //Fix Padded Bounds
-    if (rank_grid[0] == grid[0] - 1)
-        {
-            i_max -= global_padded[0] - global[0];
-        }
-
-    if (rank_grid[1] == grid[1] - 1)
-        {
-            j_max -= global_padded[1] - global[1];
-        }
-
 
 
     printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
@@ -290,11 +262,21 @@ int main(int argc, char ** argv)
 
 
     //Define MPI_Requests for all interactions
-    MPI_Request mpi_reqns_1, mpi_reqns_2;
-    MPI_Request mpi_reqew_1, mpi_reqew_2;
+    //Every request is completed before its handle is used again
+    MPI_Request mpi_reqns[4], mpi_reqew[4]; //row and column exchange at the start of an iteration
+    MPI_Request * mpi_reqpt;                //last point of every row sent east during the sweep
+    MPI_Request mpi_reqs;                   //last row sent south after the sweep
+    int nns, nwe, npt;
     MPI_Status mpistatus;
+    mpi_reqpt = (MPI_Request *)malloc(local[0] * sizeof(MPI_Request));
     //----Computational core----//
     gettimeofday(&tts, NULL); //Get Starting Time
+
+    if (omega_auto)
+        omega = sor_omega(jacobi_radius(CART_COMM, 0, estimate, local[0], local[1], north, south, east, west, i_min, i_max, j_min, j_max, NULL));
+    omega_start = omega;
+    if (refine)
+        sched_omega(&sched, omega, 1);
 #   ifdef TEST_CONV
     for (t = 0; t < T && !global_converged; t++)
         {
@@ -320,92 +302,97 @@ int main(int argc, char ** argv)
                     */
                     //Invoke send and recv async requests for anything that can be transfered
                     //North South interaction
-                    if (north != -1 || south != -1)
+                    nns = 0;
+                    if (north != -1)
                         {
-                            if (north != -1)
-                                {
-                                    //Send top row to north
-                                    MPI_Isend(&u_previous[1][1], 1, mat_row, north, 50, MPI_COMM_WORLD, &mpi_reqns_1);
-                                    //Receive lower row from north
-                                    MPI_Irecv(&u_previous[0][1], 1, mat_row, north, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                                }
-                            if (south != -1)
-                                {
-                                    //Send bottom row to south
-                                    MPI_Isend(&u_previous[i_max - 1][1], 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                                    //Receive top row from south
-                                    MPI_Irecv(&u_previous[i_max][1], 1, mat_row, south, 50, MPI_COMM_WORLD, &mpi_reqns_1);
-                                }
-                            //Wait for completion
-                            MPI_Wait(&mpi_reqns_1, &mpistatus);
-                            MPI_Wait(&mpi_reqns_2, &mpistatus);
+                            //Send top row to north
+                            MPI_Isend(&G(u_previous, 1, 1), 1, mat_row, north, 50, MPI_COMM_WORLD, &mpi_reqns[nns++]);
+                            //Receive lower row from north
+                            MPI_Irecv(&G(u_previous, 0, 1), 1, mat_row, north, 60, MPI_COMM_WORLD, &mpi_reqns[nns++]);
                         }
+                    if (south != -1)
+                        {
+                            //Send bottom row to south
+                            MPI_Isend(&G(u_previous, i_max - 1, 1), 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns[nns++]);
+                            //Receive top row from south
+                            MPI_Irecv(&G(u_previous, i_max, 1), 1, mat_row, south, 50, MPI_COMM_WORLD, &mpi_reqns[nns++]);
+                        }
+                    //Wait for completion
+                    MPI_Waitall(nns, mpi_reqns, MPI_STATUSES_IGNORE);
                     //East West Interaction
-                    if (east != -1 || west != -1)
+                    nwe = 0;
+                    if (east != -1)
                         {
-                            if (east != -1)
-                                {
-                                    //Send Right Column to east
-                                    MPI_Isend(&u_previous[i_min][j_max - 1], 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                                    //Receive
-                                    MPI_Irecv(&u_previous[i_min][j_max], 1, mat_column, east, 80, MPI_COMM_WORLD, &mpi_reqew_2);
-                                }
-                            if (west != -1)
-                                {
-                                    MPI_Isend(&u_previous[i_min][j_min], 1, mat_column, west, 80, MPI_COMM_WORLD, &mpi_reqew_2);
-                                    //Receive left column from west
-                                    MPI_Irecv(&u_previous[i_min][0], 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                                }
-                            //Wait for completion
-                            MPI_Wait(&mpi_reqew_1, &mpistatus);
-                            MPI_Wait(&mpi_reqew_2, &mpistatus);
+                            //Send Right Column to east
+                            MPI_Isend(&G(u_previous, 1, j_max - 1), 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew[nwe++]);
+                            //Receive
+                            MPI_Irecv(&G(u_previous, 1, j_max), 1, mat_column, east, 80, MPI_COMM_WORLD, &mpi_reqew[nwe++]);
+                        }
+                    if (west != -1)
+                        {
+                            MPI_Isend(&G(u_previous, 1, j_min), 1, mat_column, west, 80, MPI_COMM_WORLD, &mpi_reqew[nwe++]);
+                            //Receive left column from west
+                            MPI_Irecv(&G(u_previous, 1, 0), 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew[nwe++]);
                         }
+                    //Wait for completion
+                    MPI_Waitall(nwe, mpi_reqew, MPI_STATUSES_IGNORE);
 
                     //Start Computation
                     /*Add appropriate timers for computation*/
                     gettimeofday(&tcs, NULL);
 
                     //Computational Kernels
-                    //Modified GSSOR Kernel
+                    //Modified GSSOR Kernel, on test iterations fused with the update max-norm
                     int i, j;
+                    double d, res = 0;
+                    npt = 0;
+#               ifdef TEST_CONV
+                    int check = sched_due(&sched, t);
+#               else
+                    const int check = 0;
+#               endif
                     for (i = i_min; i < i_max; i++)
                         {
                             for (j = j_min; j < j_max; j++)
                                 {
                                     //Receives before Calculations
-                                    if (i == i_min && j = j_min && north != -1)
+                                    if (i == i_min && j == j_min && north != -1)
                                         {
                                             //Receive Updated Elements from Upper Process
-                                            MPI_Recv(&u_current[i_min - 1][j_min], 1, mat_row, north, 60, MPI_COMM_WORLD);
-                                            break;
+                                            MPI_Recv(&G(u_current, i_min - 1, 1), 1, mat_row, north, 60, MPI_COMM_WORLD, &mpistatus);
                                         }
 
                                     if (j == j_min && west != -1)
                                         {
                                             //Receive Updated Element from left process
-                                            MPI_Recv(&u_current[i][0], 1, MPI_DOUBLE, west, 70, MPI_COMM_WORLD);
+                                            MPI_Recv(&G(u_current, i, 0), 1, MPI_DOUBLE, west, 70, MPI_COMM_WORLD, &mpistatus);
                                         }
 
-                                    u_current[i][j] = u_previous[i][j] + (u_current[i - 1][j] + u_previous[i + 1][j] + \
-                                                                          u_current[i][j - 1] + u_previous[i][j + 1] - \
-                                                                          4 * u_previous[i][j]) * omega / 4.0;
+                                    G(u_current, i, j) = G(u_previous, i, j) + omega * (STENCIL5(u_current->data, u_previous->data, u_current->stride, (size_t)i * u_current->stride + j) - \
+                                                                                  G(u_previous, i, j));
+                                    if (check)
+                                        {
+                                            d = fabs(G(u_current, i, j) - G(u_previous, i, j));
+                                            res = (d > res) ? d : res;
+                                        }
                                     //Sends after Calculation
                                     if (j == j_max - 1 && east != -1)
                                         {
                                             //Send Updated last element to the right process
-                                            MPI_Isend(&u_current[i][j], 1, MPI_DOUBLE, east, 70, MPI_COMM_WORLD,  &mpi_reqew_2);
-                                            //MPI_Wait(&mpi_reqew_2, &mpistatus);
+                                            MPI_Isend(&G(u_current, i, j), 1, MPI_DOUBLE, east, 70, MPI_COMM_WORLD, &mpi_reqpt[npt++]);
                                         }
 
                                     if (i == i_max - 1 && j == j_max - 1 && south != -1)
                                         {
                                             //Send Updated Elements from Upper Process
-                                            MPI_Isend(&u_current[i_max-1][j_min], 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns_1);
-                                            //printf("Proc %d sending bottom row update\n", rank);
-                                            //MPI_Wait(&mpi_reqns_1, &mpistatus);
+                                            MPI_Isend(&G(u_current, i_max - 1, 1), 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqs);
                                         }
                                 }
                         }
+                    //The sends read u_current, which the iteration after next overwrites
+                    MPI_Waitall(npt, mpi_reqpt, MPI_STATUSES_IGNORE);
+                    if (south != -1)
+                        MPI_Wait(&mpi_reqs, &mpistatus);
 
 
                     gettimeofday(&tcf, NULL);
@@ -414,14 +401,22 @@ int main(int argc, char ** argv)
 
 
 #               ifdef TEST_CONV
-                    if (t % C == 0)
+                    if (check)
                         {
                             //*************TODO**************//
                             /*Test convergence*/
-                            converged = converge(&(u_previous[1]), &(u_current[1]), local[0], local[1]);
+                            //Same test as converge(): no point moved by more than e
+                            converged = (res <= e);
                             if (converged)
                                 printf("Process: %d Converged\n", rank);
-                            MPI_Allreduce(&converged, &global_converged, 1, MPI_INT, MPI_BAND, MPI_COMM_WORLD);
+                            //The global norm, not just the flag, so that every process
+                            //schedules the next test at the same iteration
+                            sched_start(&sched, t);
+                            MPI_Allreduce(&res, &global_res, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                            sched_update(&sched, t, global_res);
+                            if (refine)
+                                omega = sched.omega;
+                            global_converged = (global_res <= e);
                         }
 #               endif
 
@@ -442,53 +437,73 @@ int main(int argc, char ** argv)
 
 
             //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
             if (rank == 0)
                 {
-                    U = allocate2d(global_padded[0], global_padded[1]);
-                    initaddr = &(U[0][0]);
+                    U = binary ? NULL : allocate2d(global[0], global[1], 0);
                     printf("Value of T : %d\n", T);
                 }
 
 
             //All Processes send data back to rank0,  rank0 receives
-            //Use Gatherv Command
-            MPI_Gatherv(&(u_current[1][1]), 1, local_block, initaddr, scattercounts, scatteroffset, global_block, 0, MPI_COMM_WORLD);
+            //Every block is received into its place by a subarray datatype
+            if (!binary)
+                gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
 
 
             //************************************//
 
             //----Printing results----//
 
+#           ifdef PRINT_RESULTS
+            char * s = malloc(50 * sizeof(char));
+            double midpoint = probe2d(u_current, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#           endif
+
             //**************TODO: Change "Jacobi" to "GaussSeidelSOR" or "RedBlackSOR" for appropriate printing****************//
             if (rank == 0)
                 {
 
 #           ifdef PRINT_RESULTS
-                    char * s = malloc(50 * sizeof(char));
-
 #           ifdef JACOBI
                     printf("Jacobi X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, midpoint);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "Jacobi", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef GSSOR
-                    printf("GaussSeidel X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("GaussSeidel X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Omega %lf OmegaStart %lf Refined %d\n", \
+                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, midpoint, omega, omega_start, sched.refined);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "GaussSeidel", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef REDBLACK
                     printf("RedBlackSOR X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, midpoint);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "RedBlackSOR", global[0], global[1], grid[0], grid[1]);
 #           endif
 
-                    fprint2d(s, U, global[0], global[1]);
-                    free(s);
+                    if (binary)
+                        strcat(s, ".bin");
+                    else
+                        fprint2d(s, U, global[0], global[1]);
+#           endif
+
+#           ifdef TEST_CONV
+                    //Wasted: estimated iterations between reaching e and the test that saw it
+                    printf("Convergence sync Every %d Checks %d Wasted %d\n", sched.every, sched.checks, sched.wasted);
 #           endif
 
                 }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                write2d(s, u_current, offset, global, hints, CART_COMM);
+            free(s);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+            free(mpi_reqpt);
             MPI_Finalize();
             return 0;
 
@@ -3,43 +3,442 @@
 #include <string.h>
 #include <math.h>
 #include <sys/time.h>
+#include <unistd.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <mpi.h>
 #include <utils.h>
+#include <decomp.h>
+#include <halo.h>
+#include <jacobi_simd.h>
+#include <stencil.h>
 
 //Computational Kernels
 
-void Jacobi(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max)
+jacobi_kernel_t jacobi_kernel = Jacobi_scalar; //SIMD variant, picked from CPUID by jacobi_select
+jacobi_res_kernel_t jacobi_res_kernel = JacobiRes_scalar; //the same variant fused with the update max-norm
+double jacobi_weight = 0; //weight of the current Chebyshev step, 0 for plain Jacobi
+stencil2d stencil; //stencil of every sweep; the SIMD Jacobi kernels are the 5-point one
+int colour = 0; //parity of the first point of the block, so that the red-black colours are global
+
+//Jacobi sweep of a stencil kind other than the SIMD 5-point one
+static inline double JacobiSweep(const int kind, grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, const int res)
+{
+    double r = 0;
+#   pragma omp parallel reduction(max:r)
+    {
+        int i, j, lo, hi;
+        double d;
+        const int s = u_previous->stride;
+        const double * restrict up = u_previous->data;
+        double * restrict uc = u_current->data;
+        thread_rows(X_min, X_max, &lo, &hi);
+        for (i = lo; i < hi; i++)
+            for (j = Y_min; j < Y_max; j++)
+                {
+                    uc[i * s + j] = STENCIL_POINT(&stencil, kind, up, up, s, i * s + j);
+                    if (res)
+                        {
+                            d = fabs(uc[i * s + j] - up[i * s + j]);
+                            r = (d > r) ? d : r;
+                        }
+                }
+    }
+    return r;
+}
+
+//In hybrid mode every thread sweeps its own contiguous band of rows
+void Jacobi(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max)
+{
+    if (stencil.kind != STENCIL_5)
+        {
+            STENCIL_CASES(&stencil, JacobiSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, 0);
+            return;
+        }
+#   pragma omp parallel
+    {
+        int lo, hi;
+        thread_rows(X_min, X_max, &lo, &hi);
+        jacobi_kernel(u_previous->data, u_current->data, u_previous->stride, lo, hi, Y_min, Y_max);
+    }
+}
+
+//Jacobi sweep that also returns the max-norm of the update, so a convergence
+//test costs no second pass over both grids
+double JacobiRes(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max)
+{
+    double res = 0;
+    if (stencil.kind != STENCIL_5)
+        return STENCIL_CASES(&stencil, JacobiSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, 1);
+#   pragma omp parallel reduction(max:res)
+    {
+        int lo, hi;
+        thread_rows(X_min, X_max, &lo, &hi);
+        res = jacobi_res_kernel(u_previous->data, u_current->data, u_previous->stride, lo, hi, Y_min, Y_max);
+    }
+    return res;
+}
+
+//Chebyshev step of weight w: u_current still holds the iterate before the one
+//in u_previous and every point only reads its own old value there, so the new
+//iterate u_current + w (J u_previous - u_current) overwrites it in place
+static inline double ChebyshevSweep(const int kind, grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double w, const int res)
+{
+    double r = 0;
+#   pragma omp parallel reduction(max:r)
+    {
+        int i, j, lo, hi;
+        double v, d;
+        const int s = u_previous->stride;
+        const double * restrict up = u_previous->data;
+        double * restrict uc = u_current->data;
+        thread_rows(X_min, X_max, &lo, &hi);
+        for (i = lo; i < hi; i++)
+            for (j = Y_min; j < Y_max; j++)
+                {
+                    v = uc[i * s + j] + w * (STENCIL_POINT(&stencil, kind, up, up, s, i * s + j) - uc[i * s + j]);
+                    uc[i * s + j] = v;
+                    if (res)
+                        {
+                            d = fabs(v - up[i * s + j]);
+                            r = (d > r) ? d : r;
+                        }
+                }
+    }
+    return r;
+}
+
+//Weight of step k of the Chebyshev iteration for a Jacobi spectrum in
+//[-rho, rho], from the weight w of step k - 1; it tends to the optimum SOR
+//factor for rho
+double ChebyshevWeight(double rho, int k, double w)
+{
+    if (k == 0)
+        return 1;
+    if (k == 1)
+        return 1 / (1 - rho * rho / 2);
+    return 1 / (1 - rho * rho * w / 4);
+}
+
+//Plain sweep if res is NULL, else fused sweep folding its update norm into *res
+//A Chebyshev step instead while jacobi_weight is set
+void JacobiStep(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double * res)
+{
+    double r;
+    if (res == NULL)
+        {
+            if (jacobi_weight > 0)
+                STENCIL_CASES(&stencil, ChebyshevSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, jacobi_weight, 0);
+            else
+                Jacobi(u_previous, u_current, X_min, X_max, Y_min, Y_max);
+        }
+    else
+        {
+            if (jacobi_weight > 0)
+                r = STENCIL_CASES(&stencil, ChebyshevSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, jacobi_weight, 1);
+            else
+                r = JacobiRes(u_previous, u_current, X_min, X_max, Y_min, Y_max);
+            if (r > *res)
+                *res = r;
+        }
+}
+
+//Temporally blocked Jacobi: k steps per halo exchange, strip by strip
+//Step s (1..k) updates rows [X_min[s], X_max[s]) and columns [Y_min[s], Y_max[s]),
+//which shrink by one per step into the k-deep ghost zone. Each strip of H rows
+//is skewed back one row per step, so it only reads rows that it or the previous
+//strip already produced and never overwrites a row the next strip still needs:
+//the two buffers are enough and a strip stays in cache for all k steps
+//The last step covers exactly the interior, its update norm goes to *res
+void JacobiTemporal(grid2d * u_previous, grid2d * u_current, int k, int H, int * X_min, int * X_max, int * Y_min, int * Y_max, double * res)
+{
+    int b, s, lo, hi;
+    for (b = X_min[1]; b - (k - 1) < X_max[1]; b += H)
+        for (s = 1; s <= k; s++)
+            {
+                lo = (b - (s - 1) > X_min[s]) ? b - (s - 1) : X_min[s];
+                hi = (b + H - (s - 1) < X_max[s]) ? b + H - (s - 1) : X_max[s];
+                if (lo < hi)
+                    {
+                        if (s % 2)
+                            JacobiStep(u_previous, u_current, lo, hi, Y_min[s], Y_max[s], (s == k) ? res : NULL);
+                        else
+                            JacobiStep(u_current, u_previous, lo, hi, Y_min[s], Y_max[s], (s == k) ? res : NULL);
+                    }
+            }
+}
+
+//Split-phase Jacobi step: the interior, which reads no ghost cells, is swept
+//in strips while the halo requests are in flight, polling them in between so
+//the library can progress them, then the one-cell frame once they completed
+//Returns the time spent in MPI polling and waiting, *done the time the halo arrived
+//and, if res is set, the update norm in *res. A stencil with corners gets its
+//columns sent as soon as polling sees the rows arrive
+double JacobiOverlap(grid2d * u_previous, grid2d * u_current, halo2d * halo, int X_min, int X_max, int Y_min, int Y_max, double * res, double * done)
+{
+    int i, H, flag = (halo->n == 0);
+    double tw = 0, t0;
+
+    *done = MPI_Wtime();
+    H = (X_max - X_min + 5) / 8;
+    if (H < 1)
+        H = 1;
+    for (i = X_min + 1; i < X_max - 1; i += H)
+        {
+            JacobiStep(u_previous, u_current, i, (i + H < X_max - 1) ? i + H : X_max - 1, Y_min + 1, Y_max - 1, res);
+            if (!flag)
+                {
+                    t0 = MPI_Wtime();
+                    flag = halo_test(halo);
+                    *done = MPI_Wtime();
+                    tw += *done - t0;
+                }
+        }
+
+    if (!flag)
+        {
+            t0 = MPI_Wtime();
+            halo_wait(halo);
+            *done = MPI_Wtime();
+            tw += *done - t0;
+        }
+
+    //Frame: first and last row, then first and last column between them
+    JacobiStep(u_previous, u_current, X_min, X_min + 1, Y_min, Y_max, res);
+    if (X_max - 1 > X_min)
+        JacobiStep(u_previous, u_current, X_max - 1, X_max, Y_min, Y_max, res);
+    JacobiStep(u_previous, u_current, X_min + 1, X_max - 1, Y_min, Y_min + 1, res);
+    if (Y_max - 1 > Y_min)
+        JacobiStep(u_previous, u_current, X_min + 1, X_max - 1, Y_max - 1, Y_max, res);
+    return tw;
+}
+
+//Temporal block depth for an X x Y subdomain on comm, from measured costs
+//A k-deep halo takes two message phases (rows, then columns with the corners)
+//every k steps, and step s of a block recomputes k - s ghost rows/columns on
+//each side with a neighbour, (k - 1) / 2 on average. With a the latency of a
+//tiny exchange, c the sweep time per point and P the exchanged perimeter, a
+//step costs 2 a / k + c P (k - 1) / 2 on top of the interior, which is minimal
+//at k = sqrt(4 a / (c P)). The bandwidth term is the same for every k
+int AutoTBlock(MPI_Comm comm, int X, int Y, double * latency, double * point)
+{
+    int d, r, k, nb[4], P = 0;
+    double out[4] = {0, 0, 0, 0}, in[4], t0 = 0;
+    MPI_Request reqs[8];
+    grid2d * up, * uc;
+
+    MPI_Cart_shift(comm, 0, 1, &nb[0], &nb[1]);
+    MPI_Cart_shift(comm, 1, 1, &nb[2], &nb[3]);
+    for (d = 0; d < 4; d++)
+        if (nb[d] != MPI_PROC_NULL)
+            P += (d < 2) ? Y : X;
+
+    //Latency: one double to and from every neighbour, after a few warm-up rounds
+    MPI_Barrier(comm);
+    for (r = -5; r < 100; r++)
+        {
+            if (r == 0)
+                t0 = MPI_Wtime();
+            for (d = 0; d < 4; d++)
+                {
+                    MPI_Isend(&out[d], 1, MPI_DOUBLE, nb[d], 90, comm, &reqs[2 * d]);
+                    MPI_Irecv(&in[d], 1, MPI_DOUBLE, nb[d], 90, comm, &reqs[2 * d + 1]);
+                }
+            MPI_Waitall(8, reqs, MPI_STATUSES_IGNORE);
+        }
+    *latency = (MPI_Wtime() - t0) / 100;
+
+    //Sweep time per point on a scratch subdomain
+    up = allocate2d(X, Y, 1);
+    uc = allocate2d(X, Y, 1);
+    Jacobi(up, uc, 1, X + 1, 1, Y + 1);
+    t0 = MPI_Wtime();
+    for (r = 0; r < 3; r++)
+        Jacobi(up, uc, 1, X + 1, 1, Y + 1);
+    *point = (MPI_Wtime() - t0) / (3.0 * X * Y);
+    free2d(up);
+    free2d(uc);
+
+    k = (P > 0) ? (int)(sqrt(4 * *latency / (*point * P)) + 0.5) : 1;
+    //The ghost zone must come from the neighbour's own rows; blocks (block_size)
+    //differ by at most one row or column, and the smallest one sets k for all
+    if (k > ((X < Y) ? X : Y) / 2)
+        k = ((X < Y) ? X : Y) / 2;
+    if (k > 64)
+        k = 64;
+    if (k < 1)
+        k = 1;
+    MPI_Allreduce(MPI_IN_PLACE, &k, 1, MPI_INT, MPI_MIN, comm);
+    return k;
+}
+
+//Coefficient k and right-hand side of the block u whose first row is global
+//row row0, computed from global positions on the grid of spacing 1 / (rows - 1)
+//Ghost cells included: a k-deep temporal block sweeps them and the variable
+//stencil reads k one point past every swept one, so they need no exchange
+void Fields(grid2d * u, int row0, int rows, int coef, double contrast, double source, float ** kfield, float ** rhsfield)
 {
     int i, j;
-    for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1]) / 4.0;
+    double h = 1.0 / (rows - 1), x;
+    const int s = u->stride;
+    if (coef)
+        {
+            *kfield = allocate_field(u);
+            for (i = 0; i < u->dimX; i++)
+                {
+                    x = (row0 + i - u->ghost) * h;
+                    x = (x < 0) ? 0 : (x > 1) ? 1 : x;
+                    for (j = 0; j < u->dimY; j++)
+                        (*kfield)[(size_t)i * s + j] = (coef == 2) ? 1 + (contrast - 1) * x : (coef == 3 && 3 * x >= 1 && 3 * x < 2) ? contrast : 1;
+                }
+            stencil_coef(&stencil, *kfield);
+        }
+    if (source != 0)
+        {
+            *rhsfield = allocate_field(u);
+            for (i = 1; i < u->dimX - 1; i++)
+                for (j = 1; j < u->dimY - 1; j++)
+                    (*rhsfield)[(size_t)i * s + j] = -h * h * source * stencil_scale(&stencil, s, (size_t)i * s + j);
+            stencil_rhs(&stencil, *rhsfield);
+        }
 }
 
-void GaussSeidel(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+//Halo datatypes of u: rows carry the ghost-deep band under the Y interior
+//columns, columns span all rows so that the east/west exchange also fills the corners
+void HaloTypes(grid2d * u, int Y, MPI_Datatype * row, MPI_Datatype * column)
+{
+    MPI_Datatype dummy;
+    MPI_Type_vector(u->ghost, Y, u->stride, MPI_DOUBLE, &dummy);
+    MPI_Type_create_resized(dummy, 0, sizeof(double), row);
+    MPI_Type_commit(row);
+    MPI_Type_vector(u->dimX, u->ghost, u->stride, MPI_DOUBLE, &dummy);
+    MPI_Type_create_resized(dummy, 0, sizeof(double), column);
+    MPI_Type_commit(column);
+}
+
+//Halo exchange of u, built once per buffer
+//The corners take a second message phase, only paid for by stencils with
+//diagonal neighbours and by deep ghost zones
+void HaloBuild(halo2d * h, grid2d * u, MPI_Comm comm, int nbr, MPI_Datatype row, MPI_Datatype column, int i_max, int j_min, int j_max, int north, int south, int east, int west)
+{
+    int ghost = u->ghost;
+    halo_init(h, comm, nbr);
+    //Top rows to north, bottom rows from north and the other way round with south
+    halo_side(h, HALO_NORTH, &G(u, ghost, ghost), &G(u, 0, ghost), row, north);
+    halo_side(h, HALO_SOUTH, &G(u, i_max - ghost, ghost), &G(u, i_max, ghost), row, south);
+    //Columns go after the rows arrived, so they also carry the corners
+    if (stencil.corners || ghost > 1)
+        halo_phase(h);
+    halo_side(h, HALO_WEST, &G(u, 0, j_min), &G(u, 0, 0), column, west);
+    halo_side(h, HALO_EAST, &G(u, 0, j_max - ghost), &G(u, 0, j_max), column, east);
+}
+
+//The X x Y block that replaces u, whose first point moved from global indices
+//from to to when the decomposition changed: the points it keeps stay, the
+//others come from their old owners
+grid2d * Migrate(grid2d * u, const int * from, const int * to, int X, int Y, MPI_Comm comm)
+{
+    grid2d * v = allocate2d(X, Y, u->ghost);
+    redistribute2d(u, from, v, to, comm);
+    free2d(u);
+    return v;
+}
+
+//The SOR sweeps take a constant stencil kind and res flag: every stencil and
+//the plain and the fused (update max-norm) variant are specialised from the same loop
+static inline double GaussSeidelSweep(const int kind, grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega, const int res)
 {
     int i, j;
+    double d, r = 0;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = u_previous[i][j] + (u_current[i - 1][j] + u_previous[i + 1][j] + u_current[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]) * omega / 4.0;
+            {
+                uc[i * s + j] = up[i * s + j] + omega * (STENCIL_POINT(&stencil, kind, uc, up, s, i * s + j) - up[i * s + j]);
+                if (res)
+                    {
+                        d = fabs(uc[i * s + j] - up[i * s + j]);
+                        r = (d > r) ? d : r;
+                    }
+            }
+    return r;
 }
 
-void RedSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+static inline double RedSORSweep(const int kind, grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega, const int res)
 {
     int i, j;
+    double d, r = 0;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
+#   pragma omp parallel for private(j, d) reduction(max:r) schedule(static)
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            if ((i + j) % 2 == 0)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]);
+            if ((i + j + colour) % 2 == 0)
+                {
+                    uc[i * s + j] = up[i * s + j] + omega * (STENCIL_POINT(&stencil, kind, up, up, s, i * s + j) - up[i * s + j]);
+                    if (res)
+                        {
+                            d = fabs(uc[i * s + j] - up[i * s + j]);
+                            r = (d > r) ? d : r;
+                        }
+                }
+    return r;
 }
 
-void BlackSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+static inline double BlackSORSweep(const int kind, grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega, const int res)
 {
     int i, j;
+    double d, r = 0;
+    const int s = u_previous->stride;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
+#   pragma omp parallel for private(j, d) reduction(max:r) schedule(static)
     for (i = X_min; i < X_max; i++)
         for (j = Y_min; j < Y_max; j++)
-            if ((i + j) % 2 == 1)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_current[i - 1][j] + u_current[i + 1][j] + u_current[i][j - 1] + u_current[i][j + 1] - 4 * u_previous[i][j]);
+            if ((i + j + colour) % 2 == 1)
+                {
+                    uc[i * s + j] = up[i * s + j] + omega * (STENCIL_POINT(&stencil, kind, uc, uc, s, i * s + j) - up[i * s + j]);
+                    if (res)
+                        {
+                            d = fabs(uc[i * s + j] - up[i * s + j]);
+                            r = (d > r) ? d : r;
+                        }
+                }
+    return r;
+}
+
+void GaussSeidel(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+{
+    STENCIL_CASES(&stencil, GaussSeidelSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, omega, 0);
+}
+
+double GaussSeidelRes(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+{
+    return STENCIL_CASES(&stencil, GaussSeidelSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, omega, 1);
+}
+
+void RedSOR(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+{
+    STENCIL_CASES(&stencil, RedSORSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, omega, 0);
+}
+
+double RedSORRes(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+{
+    return STENCIL_CASES(&stencil, RedSORSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, omega, 1);
+}
+
+void BlackSOR(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+{
+    STENCIL_CASES(&stencil, BlackSORSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, omega, 0);
+}
+
+double BlackSORRes(grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+{
+    return STENCIL_CASES(&stencil, BlackSORSweep, u_previous, u_current, X_min, X_max, Y_min, Y_max, omega, 1);
 }
 
 
@@ -47,28 +446,91 @@ int main(int argc, char ** argv)
 {
     int rank, size;
     int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
-    int global_padded[2];   //padded global matrix dimensions (if padding is not needed, global_padded=global)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
     int grid[2];            //processor grid dimensions
-    int i, j, t;
+    int i, t;
     int global_converged = 0, converged = 0; //flags for convergence, global and per process
-    MPI_Datatype dummy;     //dummy datatype used to align user-defined datatypes in memory
     double omega;           //relaxation factor - useless for Jacobi
+    int omega_auto;         //omega from a Jacobi estimate of the spectral radius
+#   if defined(GSSOR) || defined(REDBLACK)
+    double omega_start;     //omega the iterations started with
+#   endif
+    int estimate;           //Jacobi sweeps of the estimate
+    int refine;             //raise omega from the decay seen by the convergence tests
+    int ghost = 1;          //ghost layer width, as deep as the temporal block for Jacobi
+    int tstep = 1;          //time steps per iteration of the computational core
+    int generic;            //descriptor-driven kernels
+    int coef;               //coefficient field of div(k grad u): 0 none, 1 constant, 2 ramp, 3 layers
+    double contrast;        //largest to smallest coefficient
+    double source;          //constant right-hand side f, 0 for Laplace
+    float * kfield = NULL, * rhsfield = NULL; //single-precision fields with the layout of u_current
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int overlap = 0;        //split-phase iterations: sweep the interior while the halo travels
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    int conv_mode;          //convergence test: 0 blocking, 1 speculative, 2 speculative with rollback
+    int conv_lag;           //iterations a speculative test stays in flight
+    int conv_pending = 0, conv_iter = 0, conv_done; //speculative test: in flight, iteration it tested
+    double conv_local, conv_global; //update norm of a test, on this process and over all of them
+    int conv_extra = 0;     //iterations computed past the converged one
+    conv_sched sched;       //when to test: every C iterations or adaptive
+    int check = 0;          //this iteration tests convergence
+    double res;             //max-norm of the update of a test iteration
+    MPI_Request conv_req;
+    grid2d * snapshot;      //u_current at the last locally converged test (every test while omega is refined), for rollback
+    int balance;            //iterations between rebalancings of the blocks, 0 for a fixed decomposition
+    int moves = 0;          //rebalancings that moved a block boundary
+    int t_layout = 0;       //iteration the current blocks were set up at
+    double swept = 0;       //points swept by the blocks before the current ones
 
     struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
     double ttotal = 0, tcomp = 0, total_time, comp_time;
+    double tw0, tpost, twait, tdone, tsweep; //Timers of a single exchange: start, posting, waiting, completion, and the sweep
+#   if defined(GSSOR) || defined(REDBLACK)
+    double tw1;             //start of an exchange within the sweep
+#   endif
+#   ifdef GSSOR
+    MPI_Request sweep_req[2]; //last row and column of the sweep, to south and east
+    int nsweep;
+#   endif
+    double tv0, tconv = 0, conv_time; //Time spent testing convergence
+    double tb0, tbalance = 0, tmove = 0, move_time; //Sweep time since the last rebalancing, time spent rebalancing
+    double tcomm = 0, texposed = 0, thidden, comm_time, hidden_time; //Accumulated time the halo was in flight and the part of it not hidden behind computation
+#   ifdef JACOBI
+    double tkernel = 0, kernel_time, flops, total_flops; //Accumulated Jacobi sweep time and flop count for GFLOP/s
+    const char * kernel_name;
+    int tblock, tile;       //temporal blocking: steps per halo exchange, rows per cache strip
+    int * X_lo, * X_hi, * Y_lo, * Y_hi; //iteration ranges of each step of a temporal block
+    int accel;              //Chebyshev acceleration
+    int rho_auto;           //rho from a Jacobi estimate of the spectral radius
+    double rho, rho_start;  //Jacobi spectral radius the weights are built for, and its first value
+    double cheb_omega = 0;  //omega the current Chebyshev sequence started from
+    int cheb_k = 0;         //step of the current Chebyshev sequence
+    int refill = 1;         //the deep ghost zones of u_current need the boundary values
+#   endif
 
-    double ** U, ** u_current, ** u_previous, ** swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
+    grid2d * U, * u_current, * u_previous, * swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
 
 
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
     MPI_Init(&argc, &argv);
+#   endif
     MPI_Comm_size(MPI_COMM_WORLD, &size);
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
     //----Read 2D-domain dimensions and process grid dimensions from stdin----//
 
-    if (argc != 5)
+    if (argc < 5)
         {
-            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py \n");
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [tblock=k|auto] [tile=rows] [overlap=1] [accel=none|cheb] [rho=auto|r] [stencil=5|9] [generic=1] [coef=none|const|ramp|layers] [contrast=c] [source=f] [halo=p2p|nbr] [conv=sync|spec|rollback] [lag=iters] [every=auto|iters] [cmin=iters] [cmax=iters] [balance=iters] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
             exit(-1);
         }
     else
@@ -92,102 +554,191 @@ int main(int argc, char ** argv)
     MPI_Barrier(CART_COMM);
     MPI_Barrier(MPI_COMM_WORLD);
     //----Compute local 2D-subdomain dimensions----//
-    //----Test if the 2D-domain can be equally distributed to all processes----//
-    //----If not, pad 2D-domain----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
 
     for (i = 0; i < 2; i++)
         {
-            if (global[i] % grid[i] == 0)
-                {
-                    local[i] = global[i] / grid[i];
-                    global_padded[i] = global[i];
-                }
-            else
-                {
-                    local[i] = (global[i] / grid[i]) + 1;
-                    global_padded[i] = local[i] * grid[i];
-                }
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
         }
+    colour = (offset[0] + offset[1]) & 1;
 
-    //Initialization of omega
-    omega = 1.7;
-
-#   ifdef GSSOR
-    //Recalculate omega to  fit the local x size
-    omega = 2.0 / (1 + sin(3.14 / local[0]));
-#   endif
-
-    //----Allocate global 2D-domain and initialize boundary values----//
-    //----Rank 0 holds the global 2D-domain----//
-    if (rank == 0)
+    //Halo exchange backend
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
         {
-            U = allocate2d(global_padded[0], global_padded[1]);
-            init2d(U, global[0], global[1]);
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
         }
 
-    //----Allocate local 2D-subdomains u_current, u_previous----//
-    //----Add a row/column on each size for ghost cells----//
-
-    u_previous = allocate2d(local[0] + 2, local[1] + 2);
-    u_current = allocate2d(local[0] + 2, local[1] + 2);
-
-    //----Distribute global 2D-domain from rank 0 to all processes----//
-
-    //----Appropriate datatypes are defined here----//
-    /*****The usage of datatypes is optional*****/
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
+        {
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
+        }
+    hints = output_hints(argc, argv);
 
-    //----Datatype definition for the 2D-subdomain on the global matrix----//
+    //Convergence test: conv=sync blocks on the reduction, conv=spec keeps iterating
+    //while it travels and stops lag iterations later, conv=rollback then returns
+    //to the tested iteration, giving the same result as the blocking test
+    conv_mode = strcmp(option_str(argc, argv, "conv", "sync"), "spec") == 0 ? 1 : strcmp(option_str(argc, argv, "conv", "sync"), "rollback") == 0 ? 2 : 0;
+    if (!conv_mode && strcmp(option_str(argc, argv, "conv", "sync"), "sync") != 0)
+        {
+            fprintf(stderr, "conv must be sync, spec or rollback\n");
+            exit(-1);
+        }
+    conv_lag = option_int(argc, argv, "lag", 10);
+    if (conv_lag < 1)
+        conv_lag = 1;
+
+    //every=n tests every n iterations, every=auto (the default) places each test
+    //where the decay of the update norm predicts convergence, cmin to cmax apart
+    sched_init(&sched, strcmp(option_str(argc, argv, "every", "auto"), "auto") == 0 ? 0 : option_int(argc, argv, "every", C), \
+               option_int(argc, argv, "cmin", C / 10), option_int(argc, argv, "cmax", 10 * C));
+
+    //Initialization of omega: omega=auto (the default) sets the optimum for the
+    //spectral radius measured by estimate= Jacobi sweeps, omega=w fixes it
+    omega_auto = strcmp(option_str(argc, argv, "omega", "auto"), "auto") == 0;
+    omega = omega_auto ? 1.0 : atof(option_str(argc, argv, "omega", "auto"));
+    estimate = option_int(argc, argv, "estimate", 50);
+    if (estimate < 2)
+        estimate = 2;
+    refine = option_int(argc, argv, "refine", omega_auto);
+
+    //stencil=5 (the default) or 9 (the compact 9-point Laplacian); generic=1 runs
+    //the descriptor-driven kernels instead of the specialised ones
+    if (option_int(argc, argv, "stencil", 5) != 5 && option_int(argc, argv, "stencil", 5) != 9)
+        {
+            fprintf(stderr, "stencil must be 5 or 9\n");
+            exit(-1);
+        }
+    stencil_init(&stencil, option_int(argc, argv, "stencil", 5) == 9 ? STENCIL_9 : STENCIL_5);
+    generic = option_int(argc, argv, "generic", 0);
+
+    //balance=n moves the block boundaries every n iterations towards equal sweep
+    //times, for processes of different speeds; the expanded weight grids of
+    //generic=1 are built once for the first layout
+    balance = option_int(argc, argv, "balance", 0);
+    if (balance < 0)
+        balance = 0;
+    if (balance && generic)
+        {
+            if (rank == 0)
+                fprintf(stderr, "balance=%d is ignored with generic=1\n", balance);
+            balance = 0;
+        }
 
-    //UNDERSTANDING PROBLEM!!!!!!!
-    MPI_Datatype global_block;
-    MPI_Type_vector(local[0], local[1], global_padded[1], MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &global_block);
-    MPI_Type_commit(&global_block);
+    //Poisson and div(k grad u) = f on the grid of spacing h = 1 / (X - 1): source=f
+    //is a constant f, coef= a coefficient field k of the given shape, contrast
+    //times larger across the middle third of the rows (layers) or along them (ramp)
+    source = atof(option_str(argc, argv, "source", "0"));
+    contrast = atof(option_str(argc, argv, "contrast", "10"));
+    coef = strcmp(option_str(argc, argv, "coef", "none"), "const") == 0 ? 1 : strcmp(option_str(argc, argv, "coef", "none"), "ramp") == 0 ? 2 : \
+           strcmp(option_str(argc, argv, "coef", "none"), "layers") == 0 ? 3 : 0;
+    if (!coef && strcmp(option_str(argc, argv, "coef", "none"), "none") != 0)
+        {
+            fprintf(stderr, "coef must be none, const, ramp or layers\n");
+            exit(-1);
+        }
+    if (coef && stencil.kind != STENCIL_5)
+        {
+            fprintf(stderr, "coef needs stencil=5\n");
+            exit(-1);
+        }
+    if (contrast <= 0)
+        {
+            fprintf(stderr, "contrast must be positive\n");
+            exit(-1);
+        }
+#   ifdef REDBLACK
+    //Diagonal neighbours share a colour
+    if (stencil.corners)
+        {
+            fprintf(stderr, "Red-black ordering needs a stencil without corners\n");
+            exit(-1);
+        }
+#   endif
 
-    //----Datatype definition for the 2D-subdomain on the local matrix----//
+#   ifdef JACOBI
+    //Pick the widest Jacobi kernel this CPU supports
+    kernel_name = jacobi_select(&jacobi_kernel, &jacobi_res_kernel);
+    if (stencil.kind != STENCIL_5 || generic || coef || source != 0)
+        kernel_name = "scalar";
 
-    MPI_Datatype local_block;
-    MPI_Type_vector(local[0], local[1], local[1] + 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &local_block);
-    MPI_Type_commit(&local_block);
+    //Temporal blocking: exchange a tblock-deep halo, then advance tblock steps
+    //in strips of tile rows (0: as many as fit in the L2 cache)
+    //tblock=auto: as deep as the measured latency to sweep cost ratio pays for
+    if (strcmp(option_str(argc, argv, "tblock", "1"), "auto") == 0)
+        {
+            double latency, point;
+            tblock = AutoTBlock(CART_COMM, local[0], local[1], &latency, &point);
+            if (rank == 0)
+                printf("Auto tblock %d: exchange latency %g s, sweep %g s/point\n", tblock, latency, point);
+        }
+    else
+        tblock = option_int(argc, argv, "tblock", 1);
+    tile = option_int(argc, argv, "tile", 0);
+    if (tblock < 1)
+        tblock = 1;
+    ghost = tblock;
+    tstep = tblock;
+
+    //Overlap needs the halo of a single step, a temporal block needs all of it first
+    overlap = option_int(argc, argv, "overlap", 0);
+    if (overlap && tblock > 1)
+        {
+            if (rank == 0)
+                fprintf(stderr, "overlap=1 is ignored with tblock=%d\n", tblock);
+            overlap = 0;
+        }
 
-    //----Rank 0 defines positions and counts of local blocks (2D-subdomains) on global matrix----//
-    int * scatteroffset, * scattercounts;
-    if (rank == 0)
+    //Chebyshev acceleration: every step weighs the Jacobi update against the
+    //iterate before last, with weights built for a Jacobi spectrum in [-rho, rho]
+    //rho=auto (the default) measures rho with estimate= Jacobi sweeps and refines
+    //it from the decay seen by the convergence tests (refine=1), like adaptive SOR
+    accel = strcmp(option_str(argc, argv, "accel", "none"), "cheb") == 0;
+    if (!accel && strcmp(option_str(argc, argv, "accel", "none"), "none") != 0)
         {
-            scatteroffset = (int*)malloc(size * sizeof(int));
-            scattercounts = (int*)malloc(size * sizeof(int));
-            for (i = 0; i < grid[0]; i++)
-                for (j = 0; j < grid[1]; j++)
-                    {
-                        scattercounts[i * grid[1] + j] = 1;
-                        scatteroffset[i * grid[1] + j] = (local[0] * local[1] * grid[1] * i + local[1] * j);
-                    }
+            fprintf(stderr, "accel must be none or cheb\n");
+            exit(-1);
         }
+    //A step reads the iterate before last, which a temporal block has overwritten
+    if (accel && tblock > 1)
+        {
+            if (rank == 0)
+                fprintf(stderr, "accel=cheb is ignored with tblock=%d\n", tblock);
+            accel = 0;
+        }
+    rho_auto = strcmp(option_str(argc, argv, "rho", "auto"), "auto") == 0;
+    rho = rho_auto ? 0 : atof(option_str(argc, argv, "rho", "auto"));
+    refine = accel && option_int(argc, argv, "refine", rho_auto);
+    if (accel)
+        kernel_name = "chebyshev";
+#   endif
 
+    //----Allocate local 2D-subdomains u_current, u_previous----//
+    //----Add a row/column on each size for ghost cells----//
 
-    //----Rank 0 scatters the global matrix----//
+    u_previous = allocate2d(local[0], local[1], ghost);
+    u_current = allocate2d(local[0], local[1], ghost);
+    if (conv_mode == 2)
+        snapshot = allocate2d(local[0], local[1], ghost);
 
-    double * initaddr;
-    if (rank == 0)
-        initaddr = &(U[0][0]);
+    //----Coefficients and right-hand side, computed locally from global positions----//
+    if (coef || source != 0)
+        Fields(u_current, offset[0], global[0], coef, contrast, source, &kfield, &rhsfield);
+    if (generic)
+        stencil_generic(&stencil, u_current);
 
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_previous[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_current[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
+    //----Every process initializes the interior of its own block from its global position----//
 
-    if (rank == 0)
-        free2d(U, global_padded[0], global_padded[1]);
+    init_block2d(u_previous, offset[0], offset[1]);
+    init_block2d(u_current, offset[0], offset[1]);
 
     //----Define datatypes or allocate buffers for message passing----//
-    MPI_Datatype mat_row;
-    MPI_Type_vector(1, local[1], 0, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_row);
-    MPI_Type_commit(&mat_row);
-
-    MPI_Datatype mat_column;
-    MPI_Type_vector(local[0], 1, local[1] + 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
-    MPI_Type_commit(&mat_column);
+    MPI_Datatype mat_row, mat_column;
+    HaloTypes(u_previous, local[1], &mat_row, &mat_column);
 
     //************************************//
 
@@ -241,18 +792,17 @@ int main(int argc, char ** argv)
 
     int i_min, i_max, j_min, j_max;
 
-    /*Three types of ranges:
+    /*Two types of ranges over the local[0] x local[1] block (block_size):
         -internal processes
-        -boundary processes
-        -boundary processes and padded global array
+        -boundary processes, whose first or last row or column is the global boundary
     */
 
     //Init Values for internal processes
-    i_min = 1;
-    i_max = local[0] + 1;
+    i_min = ghost;
+    i_max = local[0] + ghost;
 
-    j_min = 1;
-    j_max = local[1] + 1;
+    j_min = ghost;
+    j_max = local[1] + ghost;
 
 
     //Fix stuff according to neighbors found
@@ -274,136 +824,346 @@ int main(int argc, char ** argv)
             j_max -= 1;
         }
 
-    //Fix Padded Bounds
-    if (rank_grid[0] == grid[0] - 1)
+#   ifdef JACOBI
+    //A neighbour's ghost zone must come from real rows/columns of this process
+    if (i_max < 2 * ghost || j_max < 2 * ghost)
         {
-            i_max -= global_padded[0] - global[0];
+            fprintf(stderr, "Process %d: tblock=%d is deeper than its %d x %d subdomain\n", rank, tblock, i_max - ghost, j_max - ghost);
+            MPI_Abort(MPI_COMM_WORLD, -1);
         }
 
-    if (rank_grid[1] == grid[1] - 1)
+    //Step s of a block may also update the part of the ghost zone that is still
+    //valid after s - 1 steps, boundary sides keep their fixed ranges
+    X_lo = (int*)malloc((tblock + 1) * sizeof(int));
+    X_hi = (int*)malloc((tblock + 1) * sizeof(int));
+    Y_lo = (int*)malloc((tblock + 1) * sizeof(int));
+    Y_hi = (int*)malloc((tblock + 1) * sizeof(int));
+    for (i = 1; i <= tblock; i++)
         {
-            j_max -= global_padded[1] - global[1];
+            X_lo[i] = (north != -1) ? i_min - (tblock - i) : i_min;
+            X_hi[i] = (south != -1) ? i_max + (tblock - i) : i_max;
+            Y_lo[i] = (west != -1) ? j_min - (tblock - i) : j_min;
+            Y_hi[i] = (east != -1) ? j_max + (tblock - i) : j_max;
         }
 
+    //Strip height: both buffers of a strip and its skew must fit in L2
+    if (tile <= 0)
+        {
+            long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            if (l2 <= 0)
+                l2 = 256 * 1024;
+            tile = (int)(l2 / (2 * sizeof(double) * u_previous->stride)) - tblock;
+            if (tile < 1)
+                tile = 1;
+        }
+#   endif
 
 
     printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
-           rank_grid[0], rank_grid[1], rank,  north, south, east, west, local[0] + 2, local[1] + 2, i_min, i_max, j_min, j_max);
+           rank_grid[0], rank_grid[1], rank,  north, south, east, west, u_previous->dimX, u_previous->dimY, i_min, i_max, j_min, j_max);
 
     //************************************//
 
 
 
-    //Define MPI_Requests for all interactions
-    MPI_Request mpi_reqns_1, mpi_reqns_2;
-    MPI_Request mpi_reqew_1, mpi_reqew_2;
-    MPI_Status mpistatus;
+    //----Halo exchange, built once per buffer----//
+    halo2d halos[2], * halo;
+    grid2d * halo_grid[2] = {u_previous, u_current};
+    for (i = 0; i < 2; i++)
+        HaloBuild(&halos[i], halo_grid[i], CART_COMM, nbr, mat_row, mat_column, i_max, j_min, j_max, north, south, east, west);
+
     //----Computational core----//
     gettimeofday(&tts, NULL); //Get Starting Time
+
+#   if defined(GSSOR) || defined(REDBLACK)
+    if (omega_auto)
+        omega = sor_omega(jacobi_radius(CART_COMM, nbr, estimate, local[0], local[1], north, south, east, west, i_min, i_max, j_min, j_max, &stencil));
+    omega_start = omega;
+    if (refine)
+        sched_omega(&sched, omega, 1);
+#   endif
+#   ifdef JACOBI
+    //The Chebyshev weights tend to the optimum SOR factor for rho, and the
+    //decay of a step under a rho that is too small is the square root of that
+    //of SOR under this factor, so the SOR refinement applies unchanged
+    if (accel)
+        {
+            if (rho_auto)
+                rho = jacobi_radius(CART_COMM, nbr, estimate, local[0], local[1], north, south, east, west, i_min, i_max, j_min, j_max, &stencil);
+            rho_start = rho;
+            omega = cheb_omega = sor_omega(rho);
+            if (refine)
+                sched_omega(&sched, omega, 2);
+        }
+#   endif
 #   ifdef TEST_CONV
-    for (t = 0; t < T && !global_converged; t++)
+    for (t = 0; t < T && !global_converged; t += tstep)
         {
 #   endif
 #   ifndef TEST_CONV
 #   undef T
 #   define T 65536
-            for (t = 0; t < T; t++)
+            for (t = 0; t < T; t += tstep)
                 {
 #   endif
 
+#               ifdef TEST_CONV
+                    check = !global_converged && sched_due(&sched, t);
+#               endif
+
                     //Swap Buffers
                     swap = u_previous;
                     u_previous = u_current;
                     u_current = swap;
                     //Communicate
-                    /*
-                    Message Tags:
-                    Transfer Top Row 50
-                    Transfer Bottom Row 60
-                    Transfer East Column 70
-                    Transfer West Column 80
-                    */
-
-                    //Invoke send and recv async requests for anything that can be transfered
-                    //North South interaction
-                    if (north != -1 || south != -1)
+                    halo = (u_previous == halo_grid[0]) ? &halos[0] : &halos[1];
+                    //Split phase: start the exchange and return, the sweep polls it
+                    tw0 = MPI_Wtime();
+                    if (overlap)
+                        halo_start(halo);
+                    else
+                        halo_exchange(halo);
+                    tpost = MPI_Wtime() - tw0;
+
+#               ifdef JACOBI
+                    //Deep ghost zones also hold fixed boundary values that later steps
+                    //read from u_current, which is never exchanged: copy them once
+                    if (refill && tblock > 1)
+                        copy2d(u_current, u_previous);
+                    refill = 0;
+#               endif
+
+                    //Start Computation
+                    /*Add appropriate timers for computation*/
+                    gettimeofday(&tcs, NULL);
+                    twait = 0;
+                    res = 0;
+
+                    //Computatinal Kernels
+                    //On test iterations the fused variants also return the update norm
+#               ifdef JACOBI
+                    //A refined rho starts a new Chebyshev sequence from the current iterate;
+                    //its first step is plain Jacobi, so under conv=rollback the snapshot of
+                    //the tested iteration is all it needs to restart there, as conv=sync does
+                    if (accel)
                         {
-                            if (north != -1)
+                            if (omega != cheb_omega)
                                 {
-                                    //Send top row to north
-                                    MPI_Isend(&u_previous[1][1], 1, mat_row, north, 50, MPI_COMM_WORLD, &mpi_reqns_1);
-                                    //Receive lower row from north
-                                    MPI_Irecv(&u_previous[0][1], 1, mat_row, north, 60, MPI_COMM_WORLD, &mpi_reqns_2);
+                                    rho = 2 * sqrt(omega - 1) / omega;
+                                    cheb_omega = omega;
+                                    cheb_k = 0;
                                 }
-                            if (south != -1)
-                                {
-                                    //Send bottom row to south
-                                    MPI_Isend(&u_previous[i_max - 1][1], 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                                    //Receive top row from south
-                                    MPI_Irecv(&u_previous[i_max][1], 1, mat_row, south, 50, MPI_COMM_WORLD, &mpi_reqns_1);
-                                }
-                            //Wait for completion
-                            MPI_Wait(&mpi_reqns_1, &mpistatus);
-                            MPI_Wait(&mpi_reqns_2, &mpistatus);
+                            jacobi_weight = ChebyshevWeight(rho, cheb_k++, jacobi_weight);
                         }
-                    //East West Interaction
-                    if (east != -1 || west != -1)
+                    if (overlap)
+                        twait = JacobiOverlap(u_previous, u_current, halo, i_min, i_max, j_min, j_max, check ? &res : NULL, &tdone);
+                    else if (tblock == 1)
+                        JacobiStep(u_previous, u_current, i_min, i_max, j_min, j_max, check ? &res : NULL);
+                    else
                         {
-                            if (east != -1)
-                                {
-                                    //Send Right Column to east
-                                    MPI_Isend(&u_previous[i_min][j_max - 1], 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                                    //Receive
-                                    MPI_Irecv(&u_previous[i_min][j_max], 1, mat_column, east, 80, MPI_COMM_WORLD, &mpi_reqew_2);
-                                }
-                            if (west != -1)
+                            JacobiTemporal(u_previous, u_current, tblock, tile, X_lo, X_hi, Y_lo, Y_hi, check ? &res : NULL);
+                            //An even number of steps leaves the newest values in u_previous
+                            if (tblock % 2 == 0)
                                 {
-                                    MPI_Isend(&u_previous[i_min][j_min], 1, mat_column, west, 80, MPI_COMM_WORLD, &mpi_reqew_2);
-                                    //Receive left column from west
-                                    MPI_Irecv(&u_previous[i_min][0], 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
+                                    swap = u_previous;
+                                    u_previous = u_current;
+                                    u_current = swap;
                                 }
-                            //Wait for completion
-                            MPI_Wait(&mpi_reqew_1, &mpistatus);
-                            MPI_Wait(&mpi_reqew_2, &mpistatus);
                         }
-
-                    //Start Computation
-                    /*Add appropriate timers for computation*/
-                    gettimeofday(&tcs, NULL);
-
-                    //Computatinal Kernels
-#               ifdef JACOBI
-                    Jacobi(u_previous, u_current, i_min, i_max, j_min, j_max);
 #               endif
 
 #               ifdef GSSOR
-                    GaussSeidel(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    //The sweep reads its north and west neighbours from u_current: the
+                    //ghosts on those sides wait for the rows and columns the neighbours
+                    //there just swept, and this block's last ones go on south and east,
+                    //so the blocks sweep in the order of a single-process sweep (but for
+                    //the north-east corner of the 9-point stencil, a halo value)
+                    tw1 = MPI_Wtime();
+                    if (north != -1)
+                        MPI_Recv(&G(u_current, 0, ghost), 1, mat_row, north, 90, CART_COMM, MPI_STATUS_IGNORE);
+                    if (west != -1)
+                        MPI_Recv(&G(u_current, 0, 0), 1, mat_column, west, 100, CART_COMM, MPI_STATUS_IGNORE);
+                    twait += MPI_Wtime() - tw1;
+                    if (check)
+                        res = GaussSeidelRes(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    else
+                        GaussSeidel(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    tw1 = MPI_Wtime();
+                    nsweep = 0;
+                    if (south != -1)
+                        MPI_Isend(&G(u_current, i_max - ghost, ghost), 1, mat_row, south, 90, CART_COMM, &sweep_req[nsweep++]);
+                    if (east != -1)
+                        MPI_Isend(&G(u_current, 0, j_max - ghost), 1, mat_column, east, 100, CART_COMM, &sweep_req[nsweep++]);
+                    //The column carries the ghost corners, which the next halo exchange writes
+                    MPI_Waitall(nsweep, sweep_req, MPI_STATUSES_IGNORE);
+                    twait += MPI_Wtime() - tw1;
 #               endif
 
 #               ifdef REDBLACK
-                    RedSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
-                    BlackSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    //The black points read the red ones of the neighbours from the
+                    //ghosts of u_current: exchange them between the colours
+                    if (check)
+                        res = RedSORRes(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    else
+                        RedSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    tw1 = MPI_Wtime();
+                    halo_exchange((u_current == halo_grid[0]) ? &halos[0] : &halos[1]);
+                    twait += MPI_Wtime() - tw1;
+                    if (check)
+                        res = max(res, BlackSORRes(u_previous, u_current, i_min, i_max, j_min, j_max, omega));
+                    else
+                        BlackSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
 #               endif
 
                     gettimeofday(&tcf, NULL);
+                    tsweep = (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - twait;
                     //Calculate Computation Time,  Average
-                    tcomp = (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001) / 2.;
+                    tcomp = (tcomp + tsweep) / 2.;
+                    tbalance += tsweep;
+#               ifdef JACOBI
+                    tkernel += tsweep;
+#               endif
+                    //The halo was in flight until it completed, but only posting and
+                    //waiting for it kept this process from computing
+                    tcomm += overlap ? tdone - tw0 : tpost + twait;
+                    texposed += tpost + twait;
 
 #               ifdef TEST_CONV
-                    if (t % C == 0)
+                    tv0 = MPI_Wtime();
+                    if (conv_pending)
+                        {
+                            //Keep the reduction progressing, but act on it at the same
+                            //iteration on every process: lag iterations after the test,
+                            //or earlier if the next test is due. An adaptive schedule can
+                            //place it cmin iterations after this one, so act before then
+                            if (t - conv_iter < conv_lag * tstep && (sched.every || t + tstep < conv_iter + sched.min) && !check)
+                                MPI_Test(&conv_req, &conv_done, MPI_STATUS_IGNORE);
+                            else
+                                {
+                                    MPI_Wait(&conv_req, MPI_STATUS_IGNORE);
+                                    conv_pending = 0;
+                                    sched_update(&sched, conv_iter, conv_global);
+                                    //The blocking test raises omega for the iteration after
+                                    //the tested one: conv=rollback returns there to do the same
+                                    if (refine && sched.omega != omega && conv_mode == 2 && conv_global > e)
+                                        {
+                                            copy2d(u_current, snapshot);
+                                            t = conv_iter;
+                                            check = 0;
+                                        }
+                                    if (refine)
+                                        omega = sched.omega;
+                                    if (conv_global <= e)
+                                        {
+                                            global_converged = 1;
+                                            conv_extra = (t - conv_iter) / tstep;
+                                            if (conv_mode == 2)
+                                                {
+                                                    copy2d(u_current, snapshot);
+                                                    t = conv_iter;
+                                                }
+                                        }
+                                }
+                        }
+                    if (!global_converged && check)
                         {
                             //*************TODO**************//
                             /*Test convergence*/
-                            converged = converge(&(u_previous[1]), &(u_current[1]), local[0], local[1]);
+                            //Same test as converge(): no point moved by more than e
+                            converged = (res <= e);
                             if (converged)
                                 printf("Process: %d Converged\n", rank);
-                            MPI_Allreduce(&converged, &global_converged, 1, MPI_INT, MPI_BAND, MPI_COMM_WORLD);
+                            //The global norm, not just the flag, so that every process
+                            //schedules the next test at the same iteration
+                            sched_start(&sched, t);
+                            conv_local = res;
+                            if (conv_mode)
+                                {
+                                    //Only a locally converged grid can turn out to be the final
+                                    //one, or the one omega is raised at while it is refined
+                                    if (conv_mode == 2 && (converged || refine))
+                                        copy2d(snapshot, u_current);
+                                    conv_iter = t;
+                                    MPI_Iallreduce(&conv_local, &conv_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD, &conv_req);
+                                    conv_pending = 1;
+                                }
+                            else
+                                {
+                                    MPI_Allreduce(&conv_local, &conv_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                                    sched_update(&sched, t, conv_global);
+                                    if (refine)
+                                        omega = sched.omega;
+                                    global_converged = (conv_global <= e);
+                                }
                         }
+                    tconv += MPI_Wtime() - tv0;
 #               endif
 
+                    //----Rebalancing----//
+                    //Every balance iterations each dimension is split again in proportion
+                    //to the rows (columns) a block row (column) swept per second, at the
+                    //pace of its slowest process, then the strips that changed owner
+                    //migrate and the halo is rebuilt for the new blocks
+                    if (balance && (t / tstep + 1) % balance == 0 && !global_converged)
+                        {
+                            int from[2] = {offset[0], offset[1]};
+                            tb0 = MPI_Wtime();
+                            if (balance_blocks(tbalance, 2, global, local, offset, ghost + 1, 0.05, CART_COMM))
+                                {
+                                    swept += (double)(i_max - i_min) * (j_max - j_min) * (t + tstep - t_layout);
+                                    t_layout = t + tstep;
+                                    moves++;
+                                    colour = (offset[0] + offset[1]) & 1;
+                                    halo_free(&halos[0]);
+                                    halo_free(&halos[1]);
+                                    MPI_Type_free(&mat_row);
+                                    MPI_Type_free(&mat_column);
+                                    if (kfield)
+                                        free_field(kfield, u_current);
+                                    if (rhsfield)
+                                        free_field(rhsfield, u_current);
+
+                                    u_previous = Migrate(u_previous, from, offset, local[0], local[1], CART_COMM);
+                                    u_current = Migrate(u_current, from, offset, local[0], local[1], CART_COMM);
+                                    if (conv_mode == 2)
+                                        snapshot = Migrate(snapshot, from, offset, local[0], local[1], CART_COMM);
+                                    if (coef || source != 0)
+                                        Fields(u_current, offset[0], global[0], coef, contrast, source, &kfield, &rhsfield);
+
+                                    //Only the far ends of the ranges move
+                                    i_max = local[0] + ghost - ((south == -1) ? 1 : 0);
+                                    j_max = local[1] + ghost - ((east == -1) ? 1 : 0);
+#                                   ifdef JACOBI
+                                    for (i = 1; i <= tblock; i++)
+                                        {
+                                            X_hi[i] = (south != -1) ? i_max + (tblock - i) : i_max;
+                                            Y_hi[i] = (east != -1) ? j_max + (tblock - i) : j_max;
+                                        }
+                                    refill = 1;
+#                                   endif
+                                    HaloTypes(u_previous, local[1], &mat_row, &mat_column);
+                                    halo_grid[0] = u_previous;
+                                    halo_grid[1] = u_current;
+                                    //The sweeps also read the ghost zones of u_current, which
+                                    //hold the halo of the iteration before: fill both
+                                    for (i = 0; i < 2; i++)
+                                        {
+                                            HaloBuild(&halos[i], halo_grid[i], CART_COMM, nbr, mat_row, mat_column, i_max, j_min, j_max, north, south, east, west);
+                                            halo_exchange(&halos[i]);
+                                        }
+                                }
+                            tbalance = 0;
+                            tmove += MPI_Wtime() - tb0;
+                        }
+
                     //************************************//
 
                 }
+#           ifdef TEST_CONV
+            //T reached with a speculative test still in flight
+            if (conv_pending)
+                MPI_Wait(&conv_req, MPI_STATUS_IGNORE);
+#           endif
             printf("Rank: %d,  Done Computing\n", rank);
             gettimeofday(&ttf, NULL);
 
@@ -414,56 +1174,115 @@ int main(int argc, char ** argv)
             //The following reduction is for the time sum
             MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
             MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            //Communication time and the part of it hidden behind the interior sweep, averaged over processes
+            thidden = (tcomm > texposed) ? tcomm - texposed : 0;
+            MPI_Reduce(&tcomm, &comm_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&thidden, &hidden_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tconv, &conv_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tmove, &move_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+#           ifdef JACOBI
+            //5-point: 3 additions and 1 multiplication per point, 9-point 7 and 2,
+            //variable 11 additions, 5 multiplications and a division, generic 2 per
+            //point of the stencil; a right-hand side 1 more, a Chebyshev step 3
+            i = stencil.kind & ~STENCIL_RHS;
+            flops = ((i == STENCIL_5) ? 4.0 : (i == STENCIL_9) ? 9.0 : (i == STENCIL_VAR5) ? 17.0 : 2.0 * stencil.n) + \
+                    ((stencil.kind & STENCIL_RHS) ? 1 : 0) + (accel ? 3 : 0);
+            flops *= swept + (double)(i_max - i_min) * (j_max - j_min) * (t - t_layout);
+            MPI_Reduce(&flops, &total_flops, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tkernel, &kernel_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+#           endif
 
 
             //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
             if (rank == 0)
                 {
-                    U = allocate2d(global_padded[0], global_padded[1]);
-                    initaddr = &(U[0][0]);
+                    U = binary ? NULL : allocate2d(global[0], global[1], 0);
                     printf("Value of T : %d\n", T);
                 }
 
 
             //All Processes send data back to rank0,  rank0 receives
-            //Use Gatherv Command
-            MPI_Gatherv(&(u_current[1][1]), 1, local_block, initaddr, scattercounts, scatteroffset, global_block, 0, MPI_COMM_WORLD);
+            //Every block is received into its place by a subarray datatype, that
+            //of the initial layout, so the blocks the balancer moved return to it
+            //A binary file is written from the blocks where they are
+            if (moves && !binary)
+                {
+                    int first[2] = {block_start(global[0], grid[0], rank_grid[0]), block_start(global[1], grid[1], rank_grid[1])};
+                    u_current = Migrate(u_current, offset, first, block_size(global[0], grid[0], rank_grid[0]), block_size(global[1], grid[1], rank_grid[1]), CART_COMM);
+                    offset[0] = first[0];
+                    offset[1] = first[1];
+                }
+            if (!binary)
+                gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
 
 
             //************************************//
 
             //----Printing results----//
 
+#           ifdef PRINT_RESULTS
+            char * s = malloc(50 * sizeof(char));
+            double midpoint = probe2d(u_current, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#           endif
+
             //**************TODO: Change "Jacobi" to "GaussSeidelSOR" or "RedBlackSOR" for appropriate printing****************//
             if (rank == 0)
                 {
 
 #           ifdef PRINT_RESULTS
-                    char * s = malloc(50 * sizeof(char));
-
 #           ifdef JACOBI
-                    printf("Jacobi X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("Jacobi X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Kernel %s Stencil %s GFlops %lf TBlock %d CommTime %lf CommHidden %lf Halo %s\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, \
+                           kernel_name, stencil_name(&stencil), total_flops / kernel_time * 1e-9, tblock, comm_time / size, hidden_time / size, nbr ? "nbr" : "p2p");
+                    if (accel)
+                        printf("Chebyshev Rho %lf RhoStart %lf Refined %d\n", rho, rho_start, sched.refined);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "Jacobi", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef GSSOR
-                    printf("GaussSeidel X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("GaussSeidel X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Stencil %s CommTime %lf CommHidden %lf Halo %s Omega %lf OmegaStart %lf Refined %d\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, stencil_name(&stencil), comm_time / size, hidden_time / size, nbr ? "nbr" : "p2p", \
+                           omega, omega_start, sched.refined);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "GaussSeidel", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef REDBLACK
-                    printf("RedBlackSOR X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("RedBlackSOR X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Stencil %s CommTime %lf CommHidden %lf Halo %s Omega %lf OmegaStart %lf Refined %d\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, stencil_name(&stencil), comm_time / size, hidden_time / size, nbr ? "nbr" : "p2p", \
+                           omega, omega_start, sched.refined);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "RedBlackSOR", global[0], global[1], grid[0], grid[1]);
 #           endif
 
-                    fprint2d(s, U, global[0], global[1]);
-                    free(s);
+                    if (binary)
+                        strcat(s, ".bin");
+                    else
+                        fprint2d(s, U, global[0], global[1]);
+#           endif
+                    if (balance)
+                        printf("Balance Every %d Moves %d BalanceTime %lf\n", balance, moves, move_time);
+#           ifdef TEST_CONV
+                    //Extra: iterations computed after the converged test, discarded on rollback
+                    //Wasted: estimated iterations between reaching e and the test that saw it
+                    printf("Convergence %s Every %d Checks %d Wasted %d Extra %d TestTime %lf\n", conv_mode == 2 ? "rollback" : conv_mode ? "spec" : "sync", \
+                           sched.every, sched.checks, sched.wasted, conv_extra, conv_time);
 #           endif
 
                 }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                write2d(s, u_current, offset, global, hints, CART_COMM);
+            free(s);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+            halo_free(&halos[0]);
+            halo_free(&halos[1]);
+            if (kfield)
+                free_field(kfield, u_previous);
+            if (rhsfield)
+                free_field(rhsfield, u_previous);
             MPI_Finalize();
             return 0;
 
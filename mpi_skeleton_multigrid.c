@@ -0,0 +1,778 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "mpi.h"
+#include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define MAX_LEVELS 32
+
+//A rectangle of interior points sharing one stencil: A u = c u minus the
+//weighted north, south, west and east neighbours
+typedef struct
+{
+    int i_min, i_max, j_min, j_max; //local range
+    double wn, ws, ww, we, wc;      //weights of the neighbours and of the point
+} block2d;
+
+//One level of the multigrid hierarchy, as seen by one process
+//Level l + 1 keeps the points of level l with even global indices plus the
+//last boundary, X / 2 + 1 of them a side. For an even X the last fine interval
+//becomes a shorter last coarse one, a fraction theta of the mesh width, and the
+//last interior row and column use the non-uniform second difference
+//A process owns the coarse points of the fine points it owns, so restriction
+//and prolongation only read one ghost layer of the other level
+typedef struct
+{
+    int X, Y;                  //global dimensions, boundary included
+    int r0, c0;                //global indices of the first owned row and column
+    int nx, ny;                //owned rows and columns
+    int i_min, i_max, j_min, j_max; //local range of the interior points
+    double theta[2];           //length of the last interval of each dimension, in mesh widths
+    block2d block[4];          //the interior: uniform bulk, last row, last column, their corner
+    int nblocks;
+    int shift;                 //parity of the global index of local point (0, 0)
+    int nb[4];                 //neighbours in HALO_NORTH..HALO_EAST order, -1 for none
+    grid2d * u, * v;           //correction (the solution on the finest level), second Jacobi buffer
+    grid2d * buf[2];           //u and v as allocated, keys of halo_u
+    grid2d * f, * r;           //right-hand side (NULL on the finest level), residual
+    halo2d halo_u[2], halo_r;  //ghost layer exchanges, corners included
+    MPI_Datatype row, column;
+    int gather;                //the next level is a copy of this one on rank 0
+    MPI_Comm comm;             //gather: communicator of the level
+    int * counts, * displs;    //gather: doubles and offset of every process' block
+    int * blocks;              //gather: r0, c0, nx, ny of every process
+    double * pack, * all;      //gather: this process' block, all of them on rank 0
+} level2d;
+
+int smoother_rb = 1;           //1: red-black Gauss-Seidel, 0: weighted Jacobi
+int pre_sweeps = 2, post_sweeps = 2; //smoothing sweeps before and after the coarse correction
+double comm_clock = 0;         //time spent in halo exchanges and agglomeration
+
+//Computational Kernels
+//The operator is the Laplacian scaled by the squared mesh width, 4 u minus the
+//neighbours away from the last row and column, so every level relaxes A u = f
+//the same way. The constant flags specialise the sweeps for a zero right-hand
+//side (finest level) and for the update max-norm, like the other skeletons
+
+//Relaxes the points with (i + j) % 2 == parity in place: a red sweep followed
+//by a black one is a Gauss-Seidel sweep whatever the decomposition
+static inline double ColourSweep(grid2d * u, grid2d * f, int parity, block2d * b, double omega, const int rhs, const int res)
+{
+    int i, j;
+    double d, r = 0;
+    const int s = u->stride;
+    const double wn = b->wn, ws = b->ws, ww = b->ww, we = b->we, wc = b->wc, scale = omega / b->wc;
+    double * restrict uc = u->data;
+    const double * restrict fc = rhs ? f->data : NULL;
+#   pragma omp parallel for private(j, d) reduction(max:r) schedule(static)
+    for (i = b->i_min; i < b->i_max; i++)
+        for (j = b->j_min + ((i + b->j_min + parity) & 1); j < b->j_max; j += 2)
+            {
+                d = scale * ((rhs ? fc[i * s + j] : 0) + wn * uc[(i - 1) * s + j] + ws * uc[(i + 1) * s + j] + ww * uc[i * s + j - 1] + we * uc[i * s + j + 1] - wc * uc[i * s + j]);
+                uc[i * s + j] += d;
+                if (res)
+                    {
+                        d = fabs(d);
+                        r = (d > r) ? d : r;
+                    }
+            }
+    return r;
+}
+
+//Weighted Jacobi from u_previous into u_current
+static inline double JacobiSweep(grid2d * u_previous, grid2d * u_current, grid2d * f, block2d * b, double omega, const int rhs, const int res)
+{
+    int i, j;
+    double d, r = 0;
+    const int s = u_previous->stride;
+    const double wn = b->wn, ws = b->ws, ww = b->ww, we = b->we, wc = b->wc, scale = omega / b->wc;
+    const double * restrict up = u_previous->data;
+    double * restrict uc = u_current->data;
+    const double * restrict fc = rhs ? f->data : NULL;
+#   pragma omp parallel for private(j, d) reduction(max:r) schedule(static)
+    for (i = b->i_min; i < b->i_max; i++)
+        for (j = b->j_min; j < b->j_max; j++)
+            {
+                d = scale * ((rhs ? fc[i * s + j] : 0) + wn * up[(i - 1) * s + j] + ws * up[(i + 1) * s + j] + ww * up[i * s + j - 1] + we * up[i * s + j + 1] - wc * up[i * s + j]);
+                uc[i * s + j] = up[i * s + j] + d;
+                if (res)
+                    {
+                        d = fabs(d);
+                        r = (d > r) ? d : r;
+                    }
+            }
+    return r;
+}
+
+//r = f - A u on the interior points, the boundary and missing ghosts stay 0
+static inline void ResidualSweep(grid2d * u, grid2d * f, grid2d * r, block2d * b, const int rhs)
+{
+    int i, j;
+    const int s = u->stride;
+    const double wn = b->wn, ws = b->ws, ww = b->ww, we = b->we, wc = b->wc;
+    const double * restrict uc = u->data;
+    const double * restrict fc = rhs ? f->data : NULL;
+    double * restrict rc = r->data;
+#   pragma omp parallel for private(j) schedule(static)
+    for (i = b->i_min; i < b->i_max; i++)
+        for (j = b->j_min; j < b->j_max; j++)
+            rc[i * s + j] = (rhs ? fc[i * s + j] : 0) + wn * uc[(i - 1) * s + j] + ws * uc[(i + 1) * s + j] + ww * uc[i * s + j - 1] + we * uc[i * s + j + 1] - wc * uc[i * s + j];
+}
+
+double RedBlack(level2d * lv, int parity, int res)
+{
+    int k;
+    double d, r = 0;
+    for (k = 0; k < lv->nblocks; k++)
+        {
+            if (lv->f == NULL)
+                d = res ? ColourSweep(lv->u, NULL, parity, &lv->block[k], 1.0, 0, 1) : ColourSweep(lv->u, NULL, parity, &lv->block[k], 1.0, 0, 0);
+            else
+                d = res ? ColourSweep(lv->u, lv->f, parity, &lv->block[k], 1.0, 1, 1) : ColourSweep(lv->u, lv->f, parity, &lv->block[k], 1.0, 1, 0);
+            r = (d > r) ? d : r;
+        }
+    return r;
+}
+
+//omega = 4/5 damps the upper half of the spectrum best for the 5-point stencil
+double Jacobi(level2d * lv, int res)
+{
+    int k;
+    double d, r = 0;
+    for (k = 0; k < lv->nblocks; k++)
+        {
+            if (lv->f == NULL)
+                d = res ? JacobiSweep(lv->u, lv->v, NULL, &lv->block[k], 0.8, 0, 1) : JacobiSweep(lv->u, lv->v, NULL, &lv->block[k], 0.8, 0, 0);
+            else
+                d = res ? JacobiSweep(lv->u, lv->v, lv->f, &lv->block[k], 0.8, 1, 1) : JacobiSweep(lv->u, lv->v, lv->f, &lv->block[k], 0.8, 1, 0);
+            r = (d > r) ? d : r;
+        }
+    return r;
+}
+
+void Residual(level2d * lv)
+{
+    int k;
+    for (k = 0; k < lv->nblocks; k++)
+        {
+            if (lv->f == NULL)
+                ResidualSweep(lv->u, NULL, lv->r, &lv->block[k], 0);
+            else
+                ResidualSweep(lv->u, lv->f, lv->r, &lv->block[k], 1);
+        }
+}
+
+//Full weighting of the fine residual into the coarse right-hand side, times 4
+//for the doubled mesh width: A_c e_c = 4 R r. The coarse correction starts at 0
+void Restrict(level2d * fine, level2d * coarse)
+{
+    int i, j, fi, fj;
+    const int s = fine->r->stride;
+    const double * restrict r = fine->r->data;
+    zero2d(coarse->u);
+#   pragma omp parallel for private(j, fi, fj) schedule(static)
+    for (i = coarse->i_min; i < coarse->i_max; i++)
+        for (j = coarse->j_min; j < coarse->j_max; j++)
+            {
+                fi = 2 * (coarse->r0 + i - 1) - fine->r0 + 1;
+                fj = 2 * (coarse->c0 + j - 1) - fine->c0 + 1;
+                G(coarse->f, i, j) = (4 * r[fi * s + fj] + 2 * (r[(fi - 1) * s + fj] + r[(fi + 1) * s + fj] + r[fi * s + fj - 1] + r[fi * s + fj + 1]) \
+                                      + r[(fi - 1) * s + fj - 1] + r[(fi - 1) * s + fj + 1] + r[(fi + 1) * s + fj - 1] + r[(fi + 1) * s + fj + 1]) / 4.0;
+            }
+}
+
+//Bilinear interpolation of the coarse correction, added to the fine level
+//Fine index g lies between coarse g / 2 and (g + 1) / 2, the same point if g is even
+void Prolong(level2d * coarse, level2d * fine)
+{
+    int i, j, a, b, c, d;
+    grid2d * uc = coarse->u;
+#   pragma omp parallel for private(j, a, b, c, d) schedule(static)
+    for (i = fine->i_min; i < fine->i_max; i++)
+        {
+            a = ((fine->r0 + i - 1) >> 1) - coarse->r0 + 1;
+            b = ((fine->r0 + i) >> 1) - coarse->r0 + 1;
+            for (j = fine->j_min; j < fine->j_max; j++)
+                {
+                    c = ((fine->c0 + j - 1) >> 1) - coarse->c0 + 1;
+                    d = ((fine->c0 + j) >> 1) - coarse->c0 + 1;
+                    G(fine->u, i, j) += 0.25 * (G(uc, a, c) + G(uc, a, d) + G(uc, b, c) + G(uc, b, d));
+                }
+        }
+}
+
+void Exchange(halo2d * h)
+{
+    double t0 = MPI_Wtime();
+    halo_exchange(h);
+    comm_clock += MPI_Wtime() - t0;
+}
+
+halo2d * HaloOf(level2d * lv)
+{
+    return (lv->u == lv->buf[0]) ? &lv->halo_u[0] : &lv->halo_u[1];
+}
+
+//sweeps smoothing sweeps, a halo exchange before each colour (each Jacobi sweep)
+//The update norm of the last sweep goes to *res if set
+void Smooth(level2d * lv, int sweeps, double * res)
+{
+    int k, last;
+    double r, d;
+    grid2d * swap;
+    for (k = 0; k < sweeps; k++)
+        {
+            last = (res != NULL && k == sweeps - 1);
+            Exchange(HaloOf(lv));
+            if (smoother_rb)
+                {
+                    //Red points have an even global index sum
+                    r = RedBlack(lv, lv->shift & 1, last);
+                    Exchange(HaloOf(lv));
+                    d = RedBlack(lv, (lv->shift + 1) & 1, last);
+                    r = (d > r) ? d : r;
+                }
+            else
+                {
+                    r = Jacobi(lv, last);
+                    swap = lv->u;
+                    lv->u = lv->v;
+                    lv->v = swap;
+                }
+            if (last && r > *res)
+                *res = r;
+        }
+}
+
+//Agglomeration: rank 0 collects the owned blocks of src on a level into dst
+//on its global copy, then sends them back from there
+void GatherLevel(level2d * lv, grid2d * src, grid2d * dst)
+{
+    int p, i, j, rank, size;
+    double t0 = MPI_Wtime();
+    MPI_Comm_rank(lv->comm, &rank);
+    MPI_Comm_size(lv->comm, &size);
+    for (i = 0; i < lv->nx; i++)
+        memcpy(lv->pack + (size_t)i * lv->ny, &G(src, i + 1, 1), lv->ny * sizeof(double));
+    MPI_Gatherv(lv->pack, lv->nx * lv->ny, MPI_DOUBLE, lv->all, lv->counts, lv->displs, MPI_DOUBLE, 0, lv->comm);
+    if (rank == 0)
+        for (p = 0; p < size; p++)
+            {
+                int * b = lv->blocks + 4 * p;
+                for (i = 0; i < b[2]; i++)
+                    for (j = 0; j < b[3]; j++)
+                        G(dst, b[0] + i + 1, b[1] + j + 1) = lv->all[lv->displs[p] + i * b[3] + j];
+            }
+    comm_clock += MPI_Wtime() - t0;
+}
+
+void ScatterLevel(level2d * lv, grid2d * src, grid2d * dst)
+{
+    int p, i, j, rank, size;
+    double t0 = MPI_Wtime();
+    MPI_Comm_rank(lv->comm, &rank);
+    MPI_Comm_size(lv->comm, &size);
+    if (rank == 0)
+        for (p = 0; p < size; p++)
+            {
+                int * b = lv->blocks + 4 * p;
+                for (i = 0; i < b[2]; i++)
+                    for (j = 0; j < b[3]; j++)
+                        lv->all[lv->displs[p] + i * b[3] + j] = G(src, b[0] + i + 1, b[1] + j + 1);
+            }
+    MPI_Scatterv(lv->all, lv->counts, lv->displs, MPI_DOUBLE, lv->pack, lv->nx * lv->ny, MPI_DOUBLE, 0, lv->comm);
+    for (i = 0; i < lv->nx; i++)
+        memcpy(&G(dst, i + 1, 1), lv->pack + (size_t)i * lv->ny, lv->ny * sizeof(double));
+    comm_clock += MPI_Wtime() - t0;
+}
+
+//One V-cycle from level l down, n levels in all on this process
+//The update norm of the last post-smoothing sweep of level l goes to *res if set
+void VCycle(level2d * L, int l, int n, double * res)
+{
+    int rank;
+    level2d * lv = &L[l];
+
+    if (lv->gather)
+        {
+            //Too small to share: rank 0 runs the rest of the cycle alone
+            MPI_Comm_rank(lv->comm, &rank);
+            GatherLevel(lv, lv->u, (rank == 0) ? L[l + 1].u : NULL);
+            if (lv->f != NULL)
+                GatherLevel(lv, lv->f, (rank == 0) ? L[l + 1].f : NULL);
+            if (rank == 0)
+                VCycle(L, l + 1, n, res);
+            ScatterLevel(lv, (rank == 0) ? L[l + 1].u : NULL, lv->u);
+            return;
+        }
+
+    if (l == n - 1)
+        {
+            //Coarsest level: enough sweeps to cross it a few times
+            Smooth(lv, lv->X + lv->Y, res);
+            return;
+        }
+
+    Smooth(lv, pre_sweeps, NULL);
+    //The last sweep changed the points along the ghost layer
+    Exchange(HaloOf(lv));
+    Residual(lv);
+    Exchange(&lv->halo_r);
+    Restrict(lv, lv + 1);
+    VCycle(L, l + 1, n, NULL);
+    //The coarse correction along the ghost layer, corners included
+    Exchange(HaloOf(lv + 1));
+    Prolong(lv + 1, lv);
+    Smooth(lv, post_sweeps, res);
+}
+
+//Persistent halo of one buffer of a level: rows first, then whole columns
+void LevelHalo(halo2d * h, MPI_Comm comm, int nbr, level2d * lv, grid2d * g)
+{
+    halo_init(h, comm, nbr);
+    halo_side(h, HALO_NORTH, &G(g, 1, 1), &G(g, 0, 1), lv->row, lv->nb[HALO_NORTH]);
+    halo_side(h, HALO_SOUTH, &G(g, lv->nx, 1), &G(g, lv->nx + 1, 1), lv->row, lv->nb[HALO_SOUTH]);
+    //Columns go after the rows arrived, so they also carry the corners
+    halo_phase(h);
+    halo_side(h, HALO_WEST, &G(g, 0, 1), &G(g, 0, 0), lv->column, lv->nb[HALO_WEST]);
+    halo_side(h, HALO_EAST, &G(g, 0, lv->ny), &G(g, 0, lv->ny + 1), lv->column, lv->nb[HALO_EAST]);
+}
+
+//A level owning rows [r0, r0 + nx) and columns [c0, c0 + ny) of an X x Y grid
+//whose last intervals are theta[0] and theta[1] mesh widths long
+//u and v are the buffers of the finest level, NULL to allocate them
+void LevelCreate(level2d * lv, MPI_Comm comm, int nbr, int X, int Y, double * theta, int r0, int c0, int nx, int ny, int * nb, grid2d * u, grid2d * v, int rhs)
+{
+    int k, i_last, j_last;
+    double lo[2], hi[2], mid[2];
+    MPI_Datatype dummy;
+
+    lv->X = X;
+    lv->Y = Y;
+    lv->r0 = r0;
+    lv->c0 = c0;
+    lv->nx = nx;
+    lv->ny = ny;
+    //Interior: global indices 1 to X - 2
+    lv->i_min = (r0 == 0) ? 2 : 1;
+    lv->i_max = (X - r0 < nx + 1) ? X - r0 : nx + 1;
+    lv->j_min = (c0 == 0) ? 2 : 1;
+    lv->j_max = (Y - c0 < ny + 1) ? Y - c0 : ny + 1;
+    lv->shift = (r0 + c0) & 1;
+
+    //Second difference at the last interior point of a dimension, H on the low
+    //side and theta H on the high one: weights 2 / (1 + theta) and
+    //2 / (theta (1 + theta)), 2 / theta on the point itself (1, 1, 2 if uniform)
+    for (k = 0; k < 2; k++)
+        {
+            lv->theta[k] = theta[k];
+            lo[k] = 2 / (1 + theta[k]);
+            hi[k] = 2 / (theta[k] * (1 + theta[k]));
+            mid[k] = 2 / theta[k];
+        }
+    //The last interior row (global X - 2) and column only differ if this process has them
+    i_last = (theta[0] < 1 && r0 + lv->i_max - 2 == X - 2) ? lv->i_max - 1 : lv->i_max;
+    j_last = (theta[1] < 1 && c0 + lv->j_max - 2 == Y - 2) ? lv->j_max - 1 : lv->j_max;
+    block2d parts[4] =
+    {
+        {lv->i_min, i_last, lv->j_min, j_last, 1, 1, 1, 1, 4},
+        {i_last, lv->i_max, lv->j_min, j_last, lo[0], hi[0], 1, 1, mid[0] + 2},
+        {lv->i_min, i_last, j_last, lv->j_max, 1, 1, lo[1], hi[1], 2 + mid[1]},
+        {i_last, lv->i_max, j_last, lv->j_max, lo[0], hi[0], lo[1], hi[1], mid[0] + mid[1]}
+    };
+    lv->nblocks = 0;
+    for (k = 0; k < 4; k++)
+        if (parts[k].i_min < parts[k].i_max && parts[k].j_min < parts[k].j_max)
+            lv->block[lv->nblocks++] = parts[k];
+    for (k = 0; k < 4; k++)
+        lv->nb[k] = nb[k];
+
+    lv->u = (u != NULL) ? u : allocate2d(nx, ny, 1);
+    lv->v = (v != NULL) ? v : (smoother_rb ? NULL : allocate2d(lv->u->X, lv->u->Y, 1));
+    lv->buf[0] = lv->u;
+    lv->buf[1] = lv->v;
+    lv->f = rhs ? allocate2d(lv->u->X, lv->u->Y, 1) : NULL;
+    lv->r = allocate2d(lv->u->X, lv->u->Y, 1);
+    lv->gather = 0;
+
+    MPI_Type_contiguous(ny, MPI_DOUBLE, &lv->row);
+    MPI_Type_commit(&lv->row);
+    MPI_Type_vector(nx + 2, 1, lv->u->stride, MPI_DOUBLE, &dummy);
+    MPI_Type_create_resized(dummy, 0, sizeof(double), &lv->column);
+    MPI_Type_commit(&lv->column);
+
+    for (k = 0; k < 2; k++)
+        if (lv->buf[k] != NULL)
+            LevelHalo(&lv->halo_u[k], comm, nbr, lv, lv->buf[k]);
+    LevelHalo(&lv->halo_r, comm, nbr, lv, lv->r);
+}
+
+//Marks a level for agglomeration: rank 0 learns the block every process owns
+void GatherCreate(level2d * lv, MPI_Comm comm)
+{
+    int p, rank, size, own[4] = {lv->r0, lv->c0, lv->nx, lv->ny};
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    lv->gather = 1;
+    lv->comm = comm;
+    lv->blocks = lv->counts = lv->displs = NULL;
+    lv->all = NULL;
+    lv->pack = (double*)malloc((size_t)lv->nx * lv->ny * sizeof(double));
+    if (rank == 0)
+        {
+            lv->blocks = (int*)malloc(4 * size * sizeof(int));
+            lv->counts = (int*)malloc(size * sizeof(int));
+            lv->displs = (int*)malloc(size * sizeof(int));
+        }
+    MPI_Gather(own, 4, MPI_INT, lv->blocks, 4, MPI_INT, 0, comm);
+    if (rank == 0)
+        {
+            for (p = 0; p < size; p++)
+                {
+                    lv->counts[p] = lv->blocks[4 * p + 2] * lv->blocks[4 * p + 3];
+                    lv->displs[p] = (p == 0) ? 0 : lv->displs[p - 1] + lv->counts[p - 1];
+                }
+            lv->all = (double*)malloc((size_t)(lv->displs[size - 1] + lv->counts[size - 1]) * sizeof(double));
+        }
+}
+
+
+int main(int argc, char ** argv)
+{
+    int rank, size;
+    int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
+    int grid[2];            //processor grid dimensions
+    int i, j, t;
+    int global_converged = 0, converged = 0; //flags for convergence, global and per process
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    int agg;                //smallest subdomain side worth a distributed level
+    double res, global_res; //update norm of the last fine sweep of a cycle, on this process and over all of them
+
+    struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
+    double ttotal = 0, tcomp = 0, total_time, comp_time;
+    double tc0, comm_time;  //Time spent communicating inside the cycles
+
+    grid2d * U, * u_current, * u_previous; //Global matrix, local current and previous matrices
+
+
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
+    MPI_Init(&argc, &argv);
+#   endif
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    //----Read 2D-domain dimensions and process grid dimensions from stdin----//
+
+    if (argc < 5)
+        {
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [smoother=rb|jacobi] [pre=sweeps] [post=sweeps] [agg=points] [halo=p2p|nbr] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
+            exit(-1);
+        }
+    else
+        {
+            global[0] = atoi(argv[1]);
+            global[1] = atoi(argv[2]);
+            grid[0] = atoi(argv[3]);
+            grid[1] = atoi(argv[4]);
+        }
+
+    //----Create 2D-cartesian communicator----//
+    //----Usage of the cartesian communicator is optional----//
+
+    MPI_Comm CART_COMM;         //CART_COMM: the new 2D-cartesian communicator
+    int periods[2] = {0, 0};    //periods={0,0}: the 2D-grid is non-periodic
+    int rank_grid[2];           //rank_grid: the position of each process on the new communicator
+
+    MPI_Cart_create(MPI_COMM_WORLD, 2, grid, periods, 0, &CART_COMM); //communicator creation
+    MPI_Cart_coords(CART_COMM, rank, 2, rank_grid);                 //rank mapping on the new communicator
+
+    MPI_Barrier(CART_COMM);
+    MPI_Barrier(MPI_COMM_WORLD);
+    //----Compute local 2D-subdomain dimensions----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
+
+    for (i = 0; i < 2; i++)
+        {
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
+        }
+
+    smoother_rb = strcmp(option_str(argc, argv, "smoother", "rb"), "jacobi") != 0;
+    if (smoother_rb && strcmp(option_str(argc, argv, "smoother", "rb"), "rb") != 0)
+        {
+            fprintf(stderr, "smoother must be rb or jacobi\n");
+            exit(-1);
+        }
+    pre_sweeps = option_int(argc, argv, "pre", 2);
+    post_sweeps = option_int(argc, argv, "post", 2);
+    if (post_sweeps < 1)
+        post_sweeps = 1;
+    //Levels whose subdomains would drop below agg points a side go to rank 0
+    agg = option_int(argc, argv, "agg", 16);
+    if (agg < 1)
+        agg = 1;
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
+        {
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
+        }
+
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
+        {
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
+        }
+    hints = output_hints(argc, argv);
+
+
+    //----Allocate local 2D-subdomains u_current, u_previous----//
+    //----Add a row/column on each size for ghost cells----//
+
+    u_previous = allocate2d(local[0], local[1], 1);
+    u_current = allocate2d(local[0], local[1], 1);
+
+    //----Every process initializes the interior of its own block from its global position----//
+
+    init_block2d(u_previous, offset[0], offset[1]);
+    init_block2d(u_current, offset[0], offset[1]);
+
+    //----Find the 4 neighbors with which a process exchanges messages----//
+
+    int north, south, east, west;
+    north = -1;
+    south = -1;
+    east = -1;
+    west = -1;
+
+    //Try to get north Process
+    if (rank_grid[0] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0] - 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos , &north);
+        }
+
+    //Try to get south Process
+    if (rank_grid[0] + 1 <= grid[0] - 1)
+        {
+            int npos[2] = {rank_grid[0] + 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos, &south);
+        }
+
+    //Try to get east Process
+    if (rank_grid[1] + 1 <= grid[1] - 1)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] + 1};
+            MPI_Cart_rank(CART_COMM, npos, &east);
+        }
+
+    //Try to get west Process
+    if (rank_grid[1] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] - 1};
+            MPI_Cart_rank(CART_COMM, npos, &west);
+        }
+
+
+    //----Multigrid hierarchy----//
+    //The finest level is the block of this process (block_size), each coarser one
+    //is distributed the same way until some process would own fewer than agg
+    //rows or columns; that level is gathered and the rest live on rank 0
+
+    level2d levels[MAX_LEVELS], * lv;
+    int nlev, ndist;        //levels on this process, distributed levels
+    int nb[4] = {north, south, west, east}, none[4] = {-1, -1, -1, -1};
+    int first[2], own[2], mins[2];
+    double theta[2] = {1, 1};
+    MPI_Comm comm = CART_COMM;
+
+    for (i = 0; i < 2; i++)
+        {
+            first[i] = offset[i];
+            own[i] = local[i];
+        }
+
+    printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d First Row %d Column %d\n", \
+           rank_grid[0], rank_grid[1], rank,  north, south, east, west, own[0], own[1], first[0], first[1]);
+
+    LevelCreate(&levels[0], CART_COMM, nbr, global[0], global[1], theta, first[0], first[1], own[0], own[1], nb, u_current, u_previous, 0);
+    nlev = 1;
+    ndist = 0;
+    //Coarsen while the next level still has interior points
+    while (nlev < MAX_LEVELS && levels[nlev - 1].X >= 4 && levels[nlev - 1].Y >= 4)
+        {
+            lv = &levels[nlev - 1];
+            for (i = 0; i < 2; i++)
+                {
+                    int X = (i == 0) ? lv->X : lv->Y, r0 = (i == 0) ? lv->r0 : lv->c0, n = (i == 0) ? lv->nx : lv->ny;
+                    int r1 = (r0 + n + 1) / 2;
+                    first[i] = (r0 + 1) / 2;
+                    own[i] = ((r1 < X / 2 + 1) ? r1 : X / 2 + 1) - first[i];
+                    //An odd X pairs up all intervals, an even one leaves the last alone
+                    theta[i] = (X % 2) ? (1 + lv->theta[i]) / 2 : lv->theta[i] / 2;
+                }
+            if (comm != MPI_COMM_SELF)
+                {
+                    MPI_Allreduce(own, mins, 2, MPI_INT, MPI_MIN, comm);
+                    if (size > 1 && (mins[0] < agg || mins[1] < agg))
+                        {
+                            GatherCreate(lv, comm);
+                            ndist = nlev;
+                            if (rank != 0)
+                                break;
+                            comm = MPI_COMM_SELF;
+                            LevelCreate(&levels[nlev], comm, 0, lv->X, lv->Y, lv->theta, 0, 0, lv->X, lv->Y, none, NULL, NULL, lv->f != NULL);
+                            nlev++;
+                            continue;
+                        }
+                }
+            LevelCreate(&levels[nlev], comm, (comm == MPI_COMM_SELF) ? 0 : nbr, lv->X / 2 + 1, lv->Y / 2 + 1, theta, first[0], first[1], own[0], own[1], \
+                        (comm == MPI_COMM_SELF) ? none : nb, NULL, NULL, 1);
+            nlev++;
+        }
+    if (ndist == 0)
+        ndist = nlev;
+
+    //----Computational core----//
+    gettimeofday(&tts, NULL); //Get Starting Time
+#   ifdef TEST_CONV
+    for (t = 0; t < T && !global_converged; t++)
+        {
+#   endif
+#   ifndef TEST_CONV
+#   undef T
+#   define T 64
+            for (t = 0; t < T; t++)
+                {
+#   endif
+
+                    res = 0;
+                    tc0 = comm_clock;
+
+                    //Start Computation
+                    /*Add appropriate timers for computation*/
+                    gettimeofday(&tcs, NULL);
+
+                    //Computational Kernels
+                    //One V-cycle, the last fine sweep fused with the update norm
+#               ifdef TEST_CONV
+                    VCycle(levels, 0, nlev, &res);
+#               else
+                    VCycle(levels, 0, nlev, NULL);
+#               endif
+
+                    gettimeofday(&tcf, NULL);
+                    tcomp = (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - (comm_clock - tc0)) / 2.;
+
+
+#               ifdef TEST_CONV
+                    //*************TODO**************//
+                    /*Test convergence*/
+                    //Same test as the relaxation methods: the last fine sweep moved no
+                    //point by more than e. Every cycle, one reduction is cheap next to it
+                    converged = (res <= e);
+                    if (converged)
+                        printf("Process: %d Converged\n", rank);
+                    MPI_Allreduce(&res, &global_res, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                    global_converged = (global_res <= e);
+#               endif
+
+                    //************************************//
+
+                }
+            printf("Rank: %d,  Done Computing\n", rank);
+            gettimeofday(&ttf, NULL);
+
+            ttotal = (ttf.tv_sec - tts.tv_sec) + (ttf.tv_usec - tts.tv_usec) * 0.000001;
+
+            MPI_Barrier(MPI_COMM_WORLD); //Make sure all processes have finished computation
+
+            //The following reduction is for the time sum
+            MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&comm_clock, &comm_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+
+
+            //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
+            if (rank == 0)
+                {
+                    U = binary ? NULL : allocate2d(global[0], global[1], 0);
+                    printf("Value of T : %d\n", T);
+                }
+
+
+            //All Processes send data back to rank0,  rank0 receives
+            //Every block is received into its place by a subarray datatype
+            //The Jacobi smoother may have left the solution in either buffer
+            u_current = levels[0].u;
+            if (!binary)
+                gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
+
+
+            //************************************//
+
+            //----Printing results----//
+
+#           ifdef PRINT_RESULTS
+            char * s = malloc(50 * sizeof(char));
+            double midpoint = probe2d(u_current, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#           endif
+
+            if (rank == 0)
+                {
+
+#           ifdef PRINT_RESULTS
+#           ifdef MULTIGRID
+                    printf("Multigrid X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Levels %d Distributed %d Smoother %s CommTime %lf Halo %s\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, \
+                           nlev, ndist, smoother_rb ? "rb" : "jacobi", comm_time / size, nbr ? "nbr" : "p2p");
+                    sprintf(s, "res%sMPI_%dx%d_%dx%d", "Multigrid", global[0], global[1], grid[0], grid[1]);
+#           endif
+
+                    if (binary)
+                        strcat(s, ".bin");
+                    else
+                        fprint2d(s, U, global[0], global[1]);
+#           endif
+
+                }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                write2d(s, u_current, offset, global, hints, CART_COMM);
+            free(s);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+            for (i = 0; i < nlev; i++)
+                {
+                    for (j = 0; j < 2; j++)
+                        if (levels[i].buf[j] != NULL)
+                            halo_free(&levels[i].halo_u[j]);
+                    halo_free(&levels[i].halo_r);
+                }
+            MPI_Finalize();
+            return 0;
+
+        }
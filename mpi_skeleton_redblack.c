@@ -5,25 +5,134 @@
 #include <sys/time.h>
 #include "mpi.h"
 #include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 //Computational Kernels
 
-void RedSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+//Branch-free SOR sweep over one colour of the split checkerboard
+//own_prev/own_cur hold the colour being updated, other its 4 neighbours
+//Row i of the colour starts at column (i + first) % 2, so the west and east
+//neighbours of plane column k are other-plane columns k + f - 1 and k + f
+//With the constant res flag set it also returns the max-norm of the update
+static inline double ColourSweep(grid2d * own_prev, grid2d * other, grid2d * own_cur, int first, int X_min, int X_max, int Y_min, int Y_max, double omega, const int res)
 {
-    int i, j;
+    int i, k, f, k_min, k_max;
+    double d, r = 0;
+    const int s = own_prev->stride;
+    const double * restrict op = own_prev->data;
+    const double * restrict ot = other->data;
+    double * restrict oc = own_cur->data;
+#   pragma omp parallel for private(k, f, k_min, k_max, d) reduction(max:r) schedule(static)
     for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            if ((i + j) % 2 == 0)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]);
+        {
+            f = (i + first) & 1;
+            k_min = (Y_min - f + 1) >> 1;
+            k_max = (Y_max - f + 1) >> 1;
+            const double * n = ot + (i - 1) * s, * b = ot + (i + 1) * s, * w = ot + i * s + f - 1;
+            for (k = k_min; k < k_max; k++)
+                {
+                    oc[i * s + k] = op[i * s + k] + (omega / 4.0) * (n[k] + b[k] + w[k] + w[k + 1] - 4 * op[i * s + k]);
+                    if (res)
+                        {
+                            d = fabs(oc[i * s + k] - op[i * s + k]);
+                            r = (d > r) ? d : r;
+                        }
+                }
+        }
+    return r;
 }
 
-void BlackSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
+//Plain sweep if res is NULL, else the fused one folding its update norm into *res,
+//so a convergence test costs no second pass over the grids
+void ColourSOR(grid2d * own_prev, grid2d * other, grid2d * own_cur, int first, int X_min, int X_max, int Y_min, int Y_max, double omega, double * res)
 {
-    int i, j;
-    for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            if ((i + j) % 2 == 1)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_current[i - 1][j] + u_current[i + 1][j] + u_current[i][j - 1] + u_current[i][j + 1] - 4 * u_previous[i][j]);
+    double r;
+    if (res == NULL)
+        ColourSweep(own_prev, other, own_cur, first, X_min, X_max, Y_min, Y_max, omega, 0);
+    else
+        {
+            r = ColourSweep(own_prev, other, own_cur, first, X_min, X_max, Y_min, Y_max, omega, 1);
+            if (r > *res)
+                *res = r;
+        }
+}
+
+void RedSOR(rbgrid2d * u_previous, rbgrid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega, double * res)
+{
+    ColourSOR(u_previous->red, u_previous->black, u_current->red, u_previous->shift, X_min, X_max, Y_min, Y_max, omega, res);
+}
+
+void BlackSOR(rbgrid2d * u_previous, rbgrid2d * u_current, int X_min, int X_max, int Y_min, int Y_max, double omega, double * res)
+{
+    ColourSOR(u_previous->black, u_current->red, u_current->black, u_previous->shift + 1, X_min, X_max, Y_min, Y_max, omega, res);
+}
+
+//Persistent halo exchange of a single colour plane
+/*
+Message Tags:
+Transfer Top Row 50
+Transfer Bottom Row 60
+Transfer East Column 70
+Transfer West Column 80
+*/
+//A plane row is one contiguous mat_row_odd, a plane column takes every other
+//row (mat_column_odd) starting at the first row that has the colour there
+void ColourHalo(halo2d * h, MPI_Comm comm, int nbr, grid2d * c, int first, int north, int south, int east, int west, int i_max, int j_min, int j_max, MPI_Datatype mat_row_odd, MPI_Datatype mat_column_odd)
+{
+    halo_init(h, comm, nbr);
+    halo_side(h, HALO_NORTH, &G(c, 1, 0), &G(c, 0, 0), mat_row_odd, north);
+    halo_side(h, HALO_SOUTH, &G(c, i_max - 1, 0), &G(c, i_max, 0), mat_row_odd, south);
+    halo_side(h, HALO_WEST, &G(c, (j_min + first) & 1, j_min / 2), &G(c, first & 1, 0), mat_column_odd, west);
+    halo_side(h, HALO_EAST, &G(c, (j_max - 1 + first) & 1, (j_max - 1) / 2), &G(c, (j_max + first) & 1, j_max / 2), mat_column_odd, east);
+}
+
+//Split-phase sweep of one colour: the interior, which reads no ghost cells, is
+//swept in strips while the halo requests are in flight, polling them in between
+//so the library can progress them, then the one-cell frame once they completed
+//Returns the time spent in MPI polling and waiting, *done the time the halo arrived
+//and, if res is set, the update norm in *res. As in JacobiOverlap, halo_test and
+//halo_wait send the second phase of a split exchange once the first arrived
+double OverlapSOR(void (* sweep)(rbgrid2d *, rbgrid2d *, int, int, int, int, double, double *), rbgrid2d * u_previous, rbgrid2d * u_current, halo2d * halo, int X_min, int X_max, int Y_min, int Y_max, double omega, double * res, double * done)
+{
+    int i, H, flag = (halo->n == 0);
+    double tw = 0, t0;
+
+    *done = MPI_Wtime();
+    H = (X_max - X_min + 5) / 8;
+    if (H < 1)
+        H = 1;
+    for (i = X_min + 1; i < X_max - 1; i += H)
+        {
+            sweep(u_previous, u_current, i, (i + H < X_max - 1) ? i + H : X_max - 1, Y_min + 1, Y_max - 1, omega, res);
+            if (!flag)
+                {
+                    t0 = MPI_Wtime();
+                    flag = halo_test(halo);
+                    *done = MPI_Wtime();
+                    tw += *done - t0;
+                }
+        }
+
+    if (!flag)
+        {
+            t0 = MPI_Wtime();
+            halo_wait(halo);
+            *done = MPI_Wtime();
+            tw += *done - t0;
+        }
+
+    //Frame: first and last row, then first and last column between them
+    sweep(u_previous, u_current, X_min, X_min + 1, Y_min, Y_max, omega, res);
+    if (X_max - 1 > X_min)
+        sweep(u_previous, u_current, X_max - 1, X_max, Y_min, Y_max, omega, res);
+    sweep(u_previous, u_current, X_min + 1, X_max - 1, Y_min, Y_min + 1, omega, res);
+    if (Y_max - 1 > Y_min)
+        sweep(u_previous, u_current, X_min + 1, X_max - 1, Y_max - 1, Y_max, omega, res);
+    return tw;
 }
 
 
@@ -31,28 +140,60 @@ int main(int argc, char ** argv)
 {
     int rank, size;
     int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
-    int global_padded[2];   //padded global matrix dimensions (if padding is not needed, global_padded=global)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
     int grid[2];            //processor grid dimensions
-    int i, j, t;
+    int i, t;
     int global_converged = 0, converged = 0; //flags for convergence, global and per process
     MPI_Datatype dummy;     //dummy datatype used to align user-defined datatypes in memory
     double omega;           //relaxation factor - useless for Jacobi
+    int omega_auto;         //omega from a Jacobi estimate of the spectral radius
+    int estimate;           //Jacobi sweeps of the estimate
+    int refine;             //raise omega from the decay seen by the convergence tests
+    double omega_start;     //omega the iterations started with
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int overlap;            //split-phase colour sweeps: sweep the interior while the halo travels
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    int conv_mode;          //convergence test: 0 blocking, 1 speculative, 2 speculative with rollback
+    int conv_lag;           //iterations a speculative test stays in flight
+    int conv_pending = 0, conv_iter = 0, conv_done; //speculative test: in flight, iteration it tested
+    double conv_local, conv_global; //update norm of a test, on this process and over all of them
+    int conv_extra = 0;     //iterations computed past the converged one
+    conv_sched sched;       //when to test: every C iterations or adaptive
+    int check = 0;          //this iteration tests convergence
+    double res;             //max-norm of the update of a test iteration
+    MPI_Request conv_req;
+    rbgrid2d * snapshot;    //u_current at the last locally converged test (every test while omega is refined), for rollback
 
     struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
     double ttotal = 0, tcomp = 0, total_time, comp_time;
-
-    double ** U, ** u_current, ** u_previous, ** swap; //Global matrix, local current and previous matrices, pointer to swap between current and previous
-
-
+    double tw0, tpost, twait, tdone, tred; //Timers of a single exchange: start, posting, waiting, completion, and the red sweep
+    double tv0, tconv = 0, conv_time; //Time spent testing convergence
+    double tcomm = 0, texposed = 0, thidden, comm_time, hidden_time; //Accumulated time the halo was in flight and the part of it not hidden behind computation
+
+    grid2d * U, * u_local;  //Global matrix, local matrix used to scatter/gather the split grids
+    rbgrid2d * u_current, * u_previous, * swap; //local current and previous split grids, pointer to swap between current and previous
+
+
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
     MPI_Init(&argc, &argv);
+#   endif
     MPI_Comm_size(MPI_COMM_WORLD, &size);
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
     //----Read 2D-domain dimensions and process grid dimensions from stdin----//
 
-    if (argc != 5)
+    if (argc < 5)
         {
-            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py \n");
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [overlap=1] [halo=p2p|nbr] [conv=sync|spec|rollback] [lag=iters] [every=auto|iters] [cmin=iters] [cmax=iters] [omega=auto|w] [estimate=sweeps] [refine=0|1] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
             exit(-1);
         }
     else
@@ -76,106 +217,83 @@ int main(int argc, char ** argv)
     MPI_Barrier(CART_COMM);
     MPI_Barrier(MPI_COMM_WORLD);
     //----Compute local 2D-subdomain dimensions----//
-    //----Test if the 2D-domain can be equally distributed to all processes----//
-    //----If not, pad 2D-domain----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
 
     for (i = 0; i < 2; i++)
         {
-            if (global[i] % grid[i] == 0)
-                {
-                    local[i] = global[i] / grid[i];
-                    global_padded[i] = global[i];
-                }
-            else
-                {
-                    local[i] = (global[i] / grid[i]) + 1;
-                    global_padded[i] = local[i] * grid[i];
-                }
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
         }
 
-    //Initialization of omega
-    omega = 2.0 / (1 + sin(3.14 / global[0]));
-
-
-    //----Allocate global 2D-domain and initialize boundary values----//
-    //----Rank 0 holds the global 2D-domain----//
-    if (rank == 0)
+    //Initialization of omega: omega=auto (the default) sets the optimum for the
+    //spectral radius measured by estimate= Jacobi sweeps, omega=w fixes it
+    omega_auto = strcmp(option_str(argc, argv, "omega", "auto"), "auto") == 0;
+    omega = omega_auto ? 1.0 : atof(option_str(argc, argv, "omega", "auto"));
+    estimate = option_int(argc, argv, "estimate", 50);
+    if (estimate < 2)
+        estimate = 2;
+    refine = option_int(argc, argv, "refine", omega_auto);
+
+    overlap = option_int(argc, argv, "overlap", 0);
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
         {
-            U = allocate2d(global_padded[0], global_padded[1]);
-            init2d(U, global[0], global[1]);
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
         }
 
-    //----Allocate local 2D-subdomains u_current, u_previous----//
-    //----Add a row/column on each size for ghost cells----//
-
-    u_previous = allocate2d(local[0] + 2, local[1] + 2);
-    u_current = allocate2d(local[0] + 2, local[1] + 2);
-
-    //----Distribute global 2D-domain from rank 0 to all processes----//
-
-    //----Appropriate datatypes are defined here----//
-    /*****The usage of datatypes is optional*****/
-
-    //----Datatype definition for the 2D-subdomain on the global matrix----//
-
-    MPI_Datatype global_block;
-    MPI_Type_vector(local[0], local[1], global_padded[1], MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &global_block);
-    MPI_Type_commit(&global_block);
-
-    //----Datatype definition for the 2D-subdomain on the local matrix----//
-
-    MPI_Datatype local_block;
-    MPI_Type_vector(local[0], local[1], local[1] + 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &local_block);
-    MPI_Type_commit(&local_block);
-
-    //----Rank 0 defines positions and counts of local blocks (2D-subdomains) on global matrix----//
-    int * scatteroffset, * scattercounts;
-    if (rank == 0)
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
         {
-            scatteroffset = (int*)malloc(size * sizeof(int));
-            scattercounts = (int*)malloc(size * sizeof(int));
-            for (i = 0; i < grid[0]; i++)
-                for (j = 0; j < grid[1]; j++)
-                    {
-                        scattercounts[i * grid[1] + j] = 1;
-                        scatteroffset[i * grid[1] + j] = (local[0] * local[1] * grid[1] * i + local[1] * j);
-                    }
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
         }
+    hints = output_hints(argc, argv);
 
+    //Convergence test: conv=sync blocks on the reduction, conv=spec keeps iterating
+    //while it travels and stops lag iterations later, conv=rollback then returns
+    //to the tested iteration, giving the same result as the blocking test
+    conv_mode = strcmp(option_str(argc, argv, "conv", "sync"), "spec") == 0 ? 1 : strcmp(option_str(argc, argv, "conv", "sync"), "rollback") == 0 ? 2 : 0;
+    if (!conv_mode && strcmp(option_str(argc, argv, "conv", "sync"), "sync") != 0)
+        {
+            fprintf(stderr, "conv must be sync, spec or rollback\n");
+            exit(-1);
+        }
+    conv_lag = option_int(argc, argv, "lag", 10);
+    if (conv_lag < 1)
+        conv_lag = 1;
 
-    //----Rank 0 scatters the global matrix----//
+    //every=n tests every n iterations, every=auto (the default) places each test
+    //where the decay of the update norm predicts convergence, cmin to cmax apart
+    sched_init(&sched, strcmp(option_str(argc, argv, "every", "auto"), "auto") == 0 ? 0 : option_int(argc, argv, "every", C), \
+               option_int(argc, argv, "cmin", C / 10), option_int(argc, argv, "cmax", 10 * C));
 
-    double * initaddr;
-    if (rank == 0)
-        initaddr = &(U[0][0]);
 
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_previous[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_current[1][1]), 1, local_block, 0, MPI_COMM_WORLD);
+    //----Allocate local 2D-subdomains u_current, u_previous----//
+    //----Add a row/column on each size for ghost cells----//
+    //----Colours follow the global index so they match across processes----//
 
-    if (rank == 0)
-        free2d(U, global_padded[0], global_padded[1]);
+    int shift = (offset[0] + offset[1]) & 1;
+    u_local = allocate2d(local[0], local[1], 1);
+    u_previous = allocate_rb(local[0], local[1], 1, shift);
+    u_current = allocate_rb(local[0], local[1], 1, shift);
+    if (conv_mode == 2)
+        snapshot = allocate_rb(local[0], local[1], 1, shift);
 
-    //----Define datatypes or allocate buffers for message passing----//
-    MPI_Datatype mat_row;
-    MPI_Type_vector(1, local[1], 0, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_row);
-    MPI_Type_commit(&mat_row);
+    //----Every process initializes the interior of its own block from its global position----//
 
-    MPI_Datatype mat_column;
-    MPI_Type_vector(local[0], 1, local[1] + 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
-    MPI_Type_commit(&mat_column);
+    init_block2d(u_local, offset[0], offset[1]);
+    split_rb(u_local, u_previous);
+    split_rb(u_local, u_current);
 
-    //RedBlack Datatype
+    //----Define datatypes or allocate buffers for message passing----//
+    //RedBlack Datatypes: a row or a column of a single colour plane
     MPI_Datatype mat_row_odd;
-    MPI_Type_vector(1, local[1] / 2, 2, MPI_DOUBLE, &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_row_odd);
+    MPI_Type_contiguous(u_previous->red->Y, MPI_DOUBLE, &mat_row_odd);
     MPI_Type_commit(&mat_row_odd);
 
     MPI_Datatype mat_column_odd;
-    MPI_Type_vector(local[0] / 2, 1, 2 * (local[1] + 2), MPI_DOUBLE, &dummy);
+    MPI_Type_vector(u_previous->dimX / 2, 1, 2 * u_previous->red->stride, MPI_DOUBLE, &dummy);
     MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column_odd);
     MPI_Type_commit(&mat_column_odd);
 
@@ -231,10 +349,9 @@ int main(int argc, char ** argv)
 
     int i_min, i_max, j_min, j_max;
 
-    /*Three types of ranges:
+    /*Two types of ranges over the local[0] x local[1] block (block_size):
         -internal processes
-        -boundary processes
-        -boundary processes and padded global array
+        -boundary processes, whose first or last row or column is the global boundary
     */
 
     //Init Values for internal processes
@@ -264,17 +381,6 @@ int main(int argc, char ** argv)
             j_max -= 1;
         }
 
-    //Fix Padded Bounds
-    if (rank_grid[0] == grid[0] - 1)
-        {
-            i_max -= global_padded[0] - global[0];
-        }
-
-    if (rank_grid[1] == grid[1] - 1)
-        {
-            j_max -= global_padded[1] - global[1];
-        }
-
 
 
     printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
@@ -284,12 +390,25 @@ int main(int argc, char ** argv)
 
 
 
-    //Define MPI_Requests for all interactions
-    MPI_Request mpi_reqns_1, mpi_reqns_2;
-    MPI_Request mpi_reqew_1, mpi_reqew_2;
-    MPI_Status mpistatus;
+    //----Persistent halo exchange, one set of requests per colour plane of each buffer----//
+    //Red is exchanged on the current buffer, black on the previous one
+    halo2d halo_red[2], halo_black[2], * halo;
+    rbgrid2d * halo_grid[2] = {u_previous, u_current};
+    for (i = 0; i < 2; i++)
+        {
+            ColourHalo(&halo_red[i], CART_COMM, nbr, halo_grid[i]->red, shift, north, south, east, west, i_max, j_min, j_max, mat_row_odd, mat_column_odd);
+            ColourHalo(&halo_black[i], CART_COMM, nbr, halo_grid[i]->black, shift + 1, north, south, east, west, i_max, j_min, j_max, mat_row_odd, mat_column_odd);
+        }
+
     //----Computational core----//
     gettimeofday(&tts, NULL); //Get Starting Time
+
+    if (omega_auto)
+        omega = sor_omega(jacobi_radius(CART_COMM, nbr, estimate, local[0], local[1], north, south, east, west, i_min, i_max, j_min, j_max, NULL));
+    omega_start = omega;
+    if (refine)
+        sched_omega(&sched, omega, 1);
+
 #   ifdef TEST_CONV
     for (t = 0; t < T && !global_converged; t++)
         {
@@ -301,129 +420,145 @@ int main(int argc, char ** argv)
                 {
 #   endif
 
+#               ifdef TEST_CONV
+                    check = !global_converged && sched_due(&sched, t);
+#               endif
+                    res = 0;
+
                     //Swap Buffers
                     swap = u_previous;
                     u_previous = u_current;
                     u_current = swap;
-                    //Communicate
-                    /*
-                    Message Tags:
-                    Transfer Top Row 50
-                    Transfer Bottom Row 60
-                    Transfer East Column 70
-                    Transfer West Column 80
-                    */
-                    //Invoke send and recv async requests for anything that can be transfered
-                    //North South interaction
-                    if (north != -1 || south != -1)
-                        {
-                            if (north != -1)
-                                {
-                                    //Send top row to north
-                                    MPI_Isend(&u_previous[1][1], 1, mat_row, north, 50, MPI_COMM_WORLD, &mpi_reqns_1);
-                                    //Receive lower row from north
-                                    MPI_Irecv(&u_previous[0][1], 1, mat_row, north, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                                }
-                            if (south != -1)
-                                {
-                                    //Send bottom row to south
-                                    MPI_Isend(&u_previous[i_max - 1][1], 1, mat_row, south, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                                    //Receive top row from south
-                                    MPI_Irecv(&u_previous[i_max][1], 1, mat_row, south, 50, MPI_COMM_WORLD, &mpi_reqns_1);
-                                }
-                            //Wait for completion
-                            MPI_Wait(&mpi_reqns_1, &mpistatus);
-                            MPI_Wait(&mpi_reqns_2, &mpistatus);
-                        }
-                    //East West Interaction
-                    if (east != -1 || west != -1)
-                        {
-                            if (east != -1)
-                                {
-                                    //Send Right Column to east
-                                    MPI_Isend(&u_previous[i_min][j_max - 1], 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                                    //Receive
-                                    MPI_Irecv(&u_previous[i_min][j_max], 1, mat_column, east, 80, MPI_COMM_WORLD, &mpi_reqew_2);
-                                }
-                            if (west != -1)
-                                {
-                                    MPI_Isend(&u_previous[i_min][j_min], 1, mat_column, west, 80, MPI_COMM_WORLD, &mpi_reqew_2);
-                                    //Receive left column from west
-                                    MPI_Irecv(&u_previous[i_min][0], 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                                }
-                            //Wait for completion
-                            MPI_Wait(&mpi_reqew_1, &mpistatus);
-                            MPI_Wait(&mpi_reqew_2, &mpistatus);
-                        }
+                    //Red points need the black halo of the previous grid
+                    halo = (u_previous == halo_grid[0]) ? &halo_black[0] : &halo_black[1];
+                    tw0 = MPI_Wtime();
+                    halo_start(halo);
+                    if (!overlap)
+                        halo_wait(halo);
+                    tpost = MPI_Wtime() - tw0;
 
                     //Start Computation
                     /*Add appropriate timers for computation*/
                     gettimeofday(&tcs, NULL);
 
                     //Computational Kernels
-                    RedSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    twait = 0;
+                    if (overlap)
+                        twait = OverlapSOR(RedSOR, u_previous, u_current, halo, i_min, i_max, j_min, j_max, omega, check ? &res : NULL, &tdone);
+                    else
+                        RedSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega, check ? &res : NULL);
 
                     gettimeofday(&tcf, NULL);
-                    //Calculate Computation Time,  Average
-                    tcomp = (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001) / 2.;
-
-
-                    //Transfer Rows and Columns to East and South Processes
-                    if (east != -1)
-                        {
-                            //Send the column to eastern Process
-                            //Working
-                            //MPI_Isend(&u_current[i_min][j_max - 1], 1, mat_column, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                            MPI_Isend(&u_current[2][j_max - 1], 1, mat_column_odd, east, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                            MPI_Wait(&mpi_reqew_1, &mpistatus);
-                        }
-                    if (west != -1)
-                        {
-                            //Receive column from Western Process
-                            //Working
-                            //MPI_Irecv(&u_current[i_min][0], 1, mat_column, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                            MPI_Irecv(&u_current[2][0], 1, mat_column_odd, west, 70, MPI_COMM_WORLD, &mpi_reqew_1);
-                            MPI_Wait(&mpi_reqew_1, &mpistatus);
-
-                        }
-                    if (south != -1)
-                        {
-                            //Send row to southern Process
-                            MPI_Isend(&u_current[i_max - 1][1], 1, mat_row_odd, south, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                            MPI_Wait(&mpi_reqns_2, &mpistatus);
-                        }
-                    if (north != -1)
-                        {
-                            //Receive row from northern Process
-                            MPI_Irecv(&u_current[0][1], 1, mat_row_odd, north, 60, MPI_COMM_WORLD, &mpi_reqns_2);
-                            MPI_Wait(&mpi_reqns_2, &mpistatus);
-                        }
+                    tred = (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - twait;
+                    //The halo was in flight until it completed, but only posting and
+                    //waiting for it kept this process from computing
+                    tcomm += overlap ? tdone - tw0 : tpost;
+                    texposed += tpost + twait;
+
+                    //Black points need the red halo just computed
+                    halo = (u_current == halo_grid[0]) ? &halo_red[0] : &halo_red[1];
+                    tw0 = MPI_Wtime();
+                    halo_start(halo);
+                    if (!overlap)
+                        halo_wait(halo);
+                    tpost = MPI_Wtime() - tw0;
 
                     gettimeofday(&tcs, NULL);
 
                     //Continue with Black SOR
-                    BlackSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega);
+                    twait = 0;
+                    if (overlap)
+                        twait = OverlapSOR(BlackSOR, u_previous, u_current, halo, i_min, i_max, j_min, j_max, omega, check ? &res : NULL, &tdone);
+                    else
+                        BlackSOR(u_previous, u_current, i_min, i_max, j_min, j_max, omega, check ? &res : NULL);
 
                     gettimeofday(&tcf, NULL);
-                    //Add to Computation Time,  Average
-                    tcomp += (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001) / 2.;
+                    tcomm += overlap ? tdone - tw0 : tpost;
+                    texposed += tpost + twait;
+                    //Calculate Computation Time of both colours,  Average
+                    tcomp = (tcomp + tred + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - twait) / 2.;
 
 
 #               ifdef TEST_CONV
-                    if (t % C == 0)
+                    tv0 = MPI_Wtime();
+                    if (conv_pending)
+                        {
+                            //Keep the reduction progressing, but act on it at the same
+                            //iteration on every process: lag iterations after the test,
+                            //or earlier if the next test is due. An adaptive schedule can
+                            //place it cmin iterations after this one, so act before then
+                            if (t - conv_iter < conv_lag && (sched.every || t + 1 < conv_iter + sched.min) && !check)
+                                MPI_Test(&conv_req, &conv_done, MPI_STATUS_IGNORE);
+                            else
+                                {
+                                    MPI_Wait(&conv_req, MPI_STATUS_IGNORE);
+                                    conv_pending = 0;
+                                    sched_update(&sched, conv_iter, conv_global);
+                                    //The blocking test raises omega for the iteration after
+                                    //the tested one: conv=rollback returns there to do the same
+                                    if (refine && sched.omega != omega && conv_mode == 2 && conv_global > e)
+                                        {
+                                            copy_rb(u_current, snapshot);
+                                            t = conv_iter;
+                                            check = 0;
+                                        }
+                                    if (refine)
+                                        omega = sched.omega;
+                                    if (conv_global <= e)
+                                        {
+                                            global_converged = 1;
+                                            conv_extra = t - conv_iter;
+                                            if (conv_mode == 2)
+                                                {
+                                                    copy_rb(u_current, snapshot);
+                                                    t = conv_iter;
+                                                }
+                                        }
+                                }
+                        }
+                    if (!global_converged && check)
                         {
                             //*************TODO**************//
                             /*Test convergence*/
-                            converged = converge(&(u_previous[1]), &(u_current[1]), local[0], local[1]);
+                            //No point of either colour moved by more than e: res is the max-norm of
+                            //the update, fused into the colour sweeps of this iteration
+                            converged = (res <= e);
                             if (converged)
                                 printf("Process: %d Converged\n", rank);
-                            MPI_Allreduce(&converged, &global_converged, 1, MPI_INT, MPI_BAND, MPI_COMM_WORLD);
+                            //The global norm, not just the flag, so that every process
+                            //schedules the next test at the same iteration
+                            sched_start(&sched, t);
+                            conv_local = res;
+                            if (conv_mode)
+                                {
+                                    //Only a locally converged grid can turn out to be the final
+                                    //one, or the one omega is raised at while it is refined
+                                    if (conv_mode == 2 && (converged || refine))
+                                        copy_rb(snapshot, u_current);
+                                    conv_iter = t;
+                                    MPI_Iallreduce(&conv_local, &conv_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD, &conv_req);
+                                    conv_pending = 1;
+                                }
+                            else
+                                {
+                                    MPI_Allreduce(&conv_local, &conv_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                                    sched_update(&sched, t, conv_global);
+                                    if (refine)
+                                        omega = sched.omega;
+                                    global_converged = (conv_global <= e);
+                                }
                         }
+                    tconv += MPI_Wtime() - tv0;
 #               endif
 
                     //************************************//
 
                 }
+#           ifdef TEST_CONV
+            //T reached with a speculative test still in flight
+            if (conv_pending)
+                MPI_Wait(&conv_req, MPI_STATUS_IGNORE);
+#           endif
             printf("Rank: %d,  Done Computing\n", rank);
             gettimeofday(&ttf, NULL);
 
@@ -434,57 +569,89 @@ int main(int argc, char ** argv)
             //The following reduction is for the time sum
             MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
             MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            //Communication time and the part of it hidden behind the interior sweeps, averaged over processes
+            thidden = (tcomm > texposed) ? tcomm - texposed : 0;
+            MPI_Reduce(&tcomm, &comm_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&thidden, &hidden_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tconv, &conv_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
 
 
 
             //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
             if (rank == 0)
                 {
-                    U = allocate2d(global_padded[0], global_padded[1]);
-                    initaddr = &(U[0][0]);
+                    U = binary ? NULL : allocate2d(global[0], global[1], 0);
                     printf("Value of T : %d\n", T);
                 }
 
 
             //All Processes send data back to rank0,  rank0 receives
-            //Use Gatherv Command
-            MPI_Gatherv(&(u_current[1][1]), 1, local_block, initaddr, scattercounts, scatteroffset, global_block, 0, MPI_COMM_WORLD);
+            //Every block is received into its place by a subarray datatype
+            merge_rb(u_current, u_local);
+            if (!binary)
+                gather2d((rank == 0) ? U : NULL, u_local, global, CART_COMM);
 
 
             //************************************//
 
             //----Printing results----//
 
+#           ifdef PRINT_RESULTS
+            char * s = malloc(50 * sizeof(char));
+            double midpoint = probe2d(u_local, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#           endif
+
             //**************TODO: Change "Jacobi" to "GaussSeidelSOR" or "RedBlackSOR" for appropriate printing****************//
             if (rank == 0)
                 {
 
 #           ifdef PRINT_RESULTS
-                    char * s = malloc(50 * sizeof(char));
-
 #           ifdef JACOBI
-                    printf("Jacobi X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("Jacobi X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "Jacobi", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef GSSOR
-                    printf("GaussSeidel X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("GaussSeidel X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "GaussSeidel", global[0], global[1], grid[0], grid[1]);
 #           endif
 
 #           ifdef REDBLACK
-                    printf("RedBlackSOR X %d Y %d Px %d Py %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf\n", \
-                           global[0], global[1], grid[0], grid[1], t, comp_time, total_time, U[global[0] / 2][global[1] / 2]);
+                    printf("RedBlackSOR X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf CommTime %lf CommHidden %lf Halo %s Omega %lf OmegaStart %lf Refined %d\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, comm_time / size, hidden_time / size, nbr ? "nbr" : "p2p", \
+                           omega, omega_start, sched.refined);
                     sprintf(s, "res%sMPI_%dx%d_%dx%d", "RedBlackSOR", global[0], global[1], grid[0], grid[1]);
 #           endif
 
-                    fprint2d(s, U, global[0], global[1]);
-                    free(s);
+                    if (binary)
+                        strcat(s, ".bin");
+                    else
+                        fprint2d(s, U, global[0], global[1]);
+#           endif
+#           ifdef TEST_CONV
+                    //Extra: iterations computed after the converged test, discarded on rollback
+                    //Wasted: estimated iterations between reaching e and the test that saw it
+                    printf("Convergence %s Every %d Checks %d Wasted %d Extra %d TestTime %lf\n", conv_mode == 2 ? "rollback" : conv_mode ? "spec" : "sync", \
+                           sched.every, sched.checks, sched.wasted, conv_extra, conv_time);
 #           endif
 
                 }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                write2d(s, u_local, offset, global, hints, CART_COMM);
+            free(s);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+            for (i = 0; i < 2; i++)
+                {
+                    halo_free(&halo_red[i]);
+                    halo_free(&halo_black[i]);
+                }
             MPI_Finalize();
             return 0;
 
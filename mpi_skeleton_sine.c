@@ -0,0 +1,481 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "mpi.h"
+#include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#include "dst.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//Direct solver for the Dirichlet problem on the rectangle
+//The interior points solve A d = r, A d = 4 d - (north + south + west + east),
+//r the residual of the initial values. The sine modes sin(pi k i / (nx + 1))
+//sin(pi l j / (ny + 1)) are the eigenvectors of A, with the eigenvalues
+//4 - 2 cos(pi k / (nx + 1)) - 2 cos(pi l / (ny + 1)), so
+//d = S_x S_y ( (S_x S_y r) / lambda ) 4 / ((nx + 1) (ny + 1)), S the DST-I
+//Both transforms run along contiguous lines: the blocks are redistributed to
+//row slabs for the transforms along j, then to column slabs, stored
+//transposed, for the transforms along i, and back
+
+//Redistribution between two layouts, one MPI_Alltoallw with a datatype per peer
+//describing the part of the local buffer that goes to (or comes from) it
+typedef struct
+{
+    int * scounts, * sdispls, * rcounts, * rdispls;
+    MPI_Datatype * stypes, * rtypes;
+} remap2d;
+
+//Global interior rows (or columns) [lo, hi) of the block of L from start
+void BlockRange(int start, int L, int global, int * lo, int * hi)
+{
+    *lo = (start > 1) ? start : 1;
+    *hi = (start + L < global - 1) ? start + L : global - 1;
+    if (*hi < *lo)
+        *hi = *lo;
+}
+
+//Slab q of P over the n interior rows (or columns), global indices [lo, hi)
+void SlabRange(int q, int P, int n, int * lo, int * hi)
+{
+    *lo = 1 + (int)((long)n * q / P);
+    *hi = 1 + (int)((long)n * (q + 1) / P);
+}
+
+void RemapCreate(remap2d * m, int size)
+{
+    int q;
+    m->scounts = (int*)malloc(size * sizeof(int));
+    m->sdispls = (int*)malloc(size * sizeof(int));
+    m->rcounts = (int*)malloc(size * sizeof(int));
+    m->rdispls = (int*)malloc(size * sizeof(int));
+    m->stypes = (MPI_Datatype*)malloc(size * sizeof(MPI_Datatype));
+    m->rtypes = (MPI_Datatype*)malloc(size * sizeof(MPI_Datatype));
+    for (q = 0; q < size; q++)
+        {
+            m->scounts[q] = m->rcounts[q] = 0;
+            m->sdispls[q] = m->rdispls[q] = 0;
+            m->stypes[q] = m->rtypes[q] = MPI_DOUBLE;
+        }
+}
+
+//One side of the exchange with a peer: t, offset doubles into the buffer
+//The offset goes into the datatype, not the displacement: some single
+//process MPI_Alltoallw implementations ignore the displacements
+void RemapSet(int * count, int * displ, MPI_Datatype * type, MPI_Datatype t, int offset)
+{
+    int one = 1;
+    MPI_Aint at = (MPI_Aint)offset * sizeof(double);
+    MPI_Type_create_hindexed(1, &one, &at, t, type);
+    MPI_Type_commit(type);
+    MPI_Type_free(&t);
+    *count = 1;
+    *displ = 0;
+}
+
+//Forward moves a into b, inverse b into a
+void Remap(remap2d * m, void * a, void * b, int inverse, MPI_Comm comm)
+{
+    if (!inverse)
+        MPI_Alltoallw(a, m->scounts, m->sdispls, m->stypes, b, m->rcounts, m->rdispls, m->rtypes, comm);
+    else
+        MPI_Alltoallw(b, m->rcounts, m->rdispls, m->rtypes, a, m->scounts, m->sdispls, m->stypes, comm);
+}
+
+void RemapFree(remap2d * m, int size)
+{
+    int q;
+    for (q = 0; q < size; q++)
+        {
+            if (m->scounts[q])
+                MPI_Type_free(&m->stypes[q]);
+            if (m->rcounts[q])
+                MPI_Type_free(&m->rtypes[q]);
+        }
+    free(m->scounts);
+    free(m->sdispls);
+    free(m->rcounts);
+    free(m->rdispls);
+    free(m->stypes);
+    free(m->rtypes);
+}
+
+//DST of the lines lines[k * n], k = 0 .. count - 1, two per FFT
+void Transform(dst_plan * p, double * lines, int count)
+{
+#   pragma omp parallel
+    {
+        int k;
+        double complex * work = (double complex *)malloc(dst_work(p) * sizeof(double complex));
+#       pragma omp for schedule(static)
+        for (k = 0; k < count; k += 2)
+            dst_lines(p, lines + (size_t)k * p->n, (k + 1 < count) ? lines + (size_t)(k + 1) * p->n : NULL, work);
+        free(work);
+    }
+}
+
+//r = b - A u on the interior points, reading the boundary values of u
+void Residual(grid2d * u, grid2d * r, int X_min, int X_max, int Y_min, int Y_max)
+{
+    int i, j;
+#   pragma omp parallel for private(j) schedule(static)
+    for (i = X_min; i < X_max; i++)
+        for (j = Y_min; j < Y_max; j++)
+            G(r, i, j) = G(u, i - 1, j) + G(u, i + 1, j) + G(u, i, j - 1) + G(u, i, j + 1) - 4 * G(u, i, j);
+}
+
+
+int main(int argc, char ** argv)
+{
+    int rank, size;
+    int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
+    int grid[2];            //processor grid dimensions
+    int i, j, q;
+    MPI_Datatype dummy;     //dummy datatype used to align user-defined datatypes in memory
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    int nx, ny;             //interior points per column and per row
+    int rs, re, cs, ce;     //this process's row slab [rs, re) and column slab [cs, ce)
+    double * rows, * cols;  //row slab, (re - rs) x ny, and column slab, (ce - cs) x nx
+    double * lx, * ly;      //2 - 2 cos of the sine mode frequencies along i and along j
+    dst_plan px, py;        //transforms along i and along j
+    remap2d to_rows, to_cols; //blocks to row slabs, row slabs to column slabs
+
+    struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
+    double ttotal = 0, tcomp = 0, total_time, comp_time;
+    double tw0, tremap = 0, remap_time; //Time spent in the redistributions
+
+    grid2d * U, * u_current, * r; //Global matrix, local solution and residual
+
+
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
+    MPI_Init(&argc, &argv);
+#   endif
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    //----Read 2D-domain dimensions and process grid dimensions from stdin----//
+
+    if (argc < 5)
+        {
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [halo=p2p|nbr] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
+            exit(-1);
+        }
+    else
+        {
+            global[0] = atoi(argv[1]);
+            global[1] = atoi(argv[2]);
+            grid[0] = atoi(argv[3]);
+            grid[1] = atoi(argv[4]);
+        }
+
+    //----Create 2D-cartesian communicator----//
+    //----Usage of the cartesian communicator is optional----//
+
+    MPI_Comm CART_COMM;         //CART_COMM: the new 2D-cartesian communicator
+    int periods[2] = {0, 0};    //periods={0,0}: the 2D-grid is non-periodic
+    int rank_grid[2];           //rank_grid: the position of each process on the new communicator
+
+    MPI_Cart_create(MPI_COMM_WORLD, 2, grid, periods, 0, &CART_COMM); //communicator creation
+    MPI_Cart_coords(CART_COMM, rank, 2, rank_grid);                 //rank mapping on the new communicator
+
+    MPI_Barrier(CART_COMM);
+    MPI_Barrier(MPI_COMM_WORLD);
+    //----Compute local 2D-subdomain dimensions----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
+
+    for (i = 0; i < 2; i++)
+        {
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
+        }
+
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
+        {
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
+        }
+
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
+        {
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
+        }
+    hints = output_hints(argc, argv);
+
+
+    //----Allocate local 2D-subdomain u_current and the residual----//
+    //----Add a row/column on each size for ghost cells----//
+
+    u_current = allocate2d(local[0], local[1], 1);
+    r = allocate2d(local[0], local[1], 1);
+
+    //----Every process initializes the interior of its own block from its global position----//
+
+    init_block2d(u_current, offset[0], offset[1]);
+
+    //----Define datatypes or allocate buffers for message passing----//
+
+    MPI_Datatype mat_row;
+    MPI_Type_contiguous(local[1], MPI_DOUBLE, &mat_row);
+    MPI_Type_commit(&mat_row);
+
+    MPI_Datatype mat_column;
+    MPI_Type_vector(local[0], 1, u_current->stride, MPI_DOUBLE, &dummy);
+    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
+    MPI_Type_commit(&mat_column);
+
+    //----Find the 4 neighbors with which a process exchanges messages----//
+
+    int north, south, east, west;
+    north = -1;
+    south = -1;
+    east = -1;
+    west = -1;
+
+    //Try to get north Process
+    if (rank_grid[0] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0] - 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos , &north);
+        }
+
+    //Try to get south Process
+    if (rank_grid[0] + 1 <= grid[0] - 1)
+        {
+            int npos[2] = {rank_grid[0] + 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos, &south);
+        }
+
+    //Try to get east Process
+    if (rank_grid[1] + 1 <= grid[1] - 1)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] + 1};
+            MPI_Cart_rank(CART_COMM, npos, &east);
+        }
+
+    //Try to get west Process
+    if (rank_grid[1] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] - 1};
+            MPI_Cart_rank(CART_COMM, npos, &west);
+        }
+
+
+    //---Define the iteration ranges per process-----//
+
+    int i_min, i_max, j_min, j_max;
+
+    //Global interior rows and columns of the block, local index = global - offset
+    int b_row[2], b_col[2];
+    BlockRange(offset[0], local[0], global[0], &b_row[0], &b_row[1]);
+    BlockRange(offset[1], local[1], global[1], &b_col[0], &b_col[1]);
+    i_min = b_row[0] - offset[0] + 1;
+    i_max = b_row[1] - offset[0] + 1;
+    j_min = b_col[0] - offset[1] + 1;
+    j_max = b_col[1] - offset[1] + 1;
+
+    printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
+           rank_grid[0], rank_grid[1], rank,  north, south, east, west, local[0] + 2, local[1] + 2, i_min, i_max, j_min, j_max);
+
+    //----Slabs, transforms and the redistributions between the layouts----//
+
+    nx = global[0] - 2;
+    ny = global[1] - 2;
+    SlabRange(rank, size, nx, &rs, &re);
+    SlabRange(rank, size, ny, &cs, &ce);
+    rows = (double*)calloc((size_t)(re - rs) * ny + 1, sizeof(double));
+    cols = (double*)calloc((size_t)(ce - cs) * nx + 1, sizeof(double));
+
+    dst_init(&px, nx);
+    dst_init(&py, ny);
+    lx = (double*)malloc(nx * sizeof(double));
+    ly = (double*)malloc(ny * sizeof(double));
+    for (i = 0; i < nx; i++)
+        lx[i] = 2 - 2 * cos(M_PI * (i + 1) / (nx + 1));
+    for (j = 0; j < ny; j++)
+        ly[j] = 2 - 2 * cos(M_PI * (j + 1) / (ny + 1));
+
+    RemapCreate(&to_rows, size);
+    RemapCreate(&to_cols, size);
+    for (q = 0; q < size; q++)
+        {
+            int qgrid[2], q_row[2], q_col[2], q_rs, q_re, q_cs, q_ce, lo, hi;
+            MPI_Cart_coords(CART_COMM, q, 2, qgrid);
+            BlockRange(block_start(global[0], grid[0], qgrid[0]), block_size(global[0], grid[0], qgrid[0]), global[0], &q_row[0], &q_row[1]);
+            BlockRange(block_start(global[1], grid[1], qgrid[1]), block_size(global[1], grid[1], qgrid[1]), global[1], &q_col[0], &q_col[1]);
+            SlabRange(q, size, nx, &q_rs, &q_re);
+            SlabRange(q, size, ny, &q_cs, &q_ce);
+
+            //Block to row slab: the rows of the block in the slab of q
+            lo = (b_row[0] > q_rs) ? b_row[0] : q_rs;
+            hi = (b_row[1] < q_re) ? b_row[1] : q_re;
+            if (lo < hi && b_col[0] < b_col[1])
+                {
+                    MPI_Type_vector(hi - lo, b_col[1] - b_col[0], r->stride, MPI_DOUBLE, &dummy);
+                    RemapSet(&to_rows.scounts[q], &to_rows.sdispls[q], &to_rows.stypes[q], dummy, (lo - b_row[0] + i_min) * r->stride + j_min);
+                }
+            lo = (q_row[0] > rs) ? q_row[0] : rs;
+            hi = (q_row[1] < re) ? q_row[1] : re;
+            if (lo < hi && q_col[0] < q_col[1])
+                {
+                    MPI_Type_vector(hi - lo, q_col[1] - q_col[0], ny, MPI_DOUBLE, &dummy);
+                    RemapSet(&to_rows.rcounts[q], &to_rows.rdispls[q], &to_rows.rtypes[q], dummy, (lo - rs) * ny + q_col[0] - 1);
+                }
+
+            //Row slab to column slab: the columns of q's slab of every row,
+            //received as a transpose, row by row, every row a strided column
+            if (rs < re && q_cs < q_ce)
+                {
+                    MPI_Type_vector(re - rs, q_ce - q_cs, ny, MPI_DOUBLE, &dummy);
+                    RemapSet(&to_cols.scounts[q], &to_cols.sdispls[q], &to_cols.stypes[q], dummy, q_cs - 1);
+                }
+            if (cs < ce && q_rs < q_re)
+                {
+                    MPI_Datatype column, stride;
+                    MPI_Type_vector(ce - cs, 1, nx, MPI_DOUBLE, &column);
+                    MPI_Type_create_resized(column, 0, sizeof(double), &stride);
+                    MPI_Type_contiguous(q_re - q_rs, stride, &dummy);
+                    RemapSet(&to_cols.rcounts[q], &to_cols.rdispls[q], &to_cols.rtypes[q], dummy, q_rs - 1);
+                    MPI_Type_free(&column);
+                    MPI_Type_free(&stride);
+                }
+        }
+
+    //Persistent halo exchange of u: the residual reads the boundary values
+    halo2d halo;
+    halo_init(&halo, CART_COMM, nbr);
+    halo_side(&halo, HALO_NORTH, &G(u_current, 1, 1), &G(u_current, 0, 1), mat_row, north);
+    halo_side(&halo, HALO_SOUTH, &G(u_current, local[0], 1), &G(u_current, local[0] + 1, 1), mat_row, south);
+    halo_side(&halo, HALO_WEST, &G(u_current, 1, 1), &G(u_current, 1, 0), mat_column, west);
+    halo_side(&halo, HALO_EAST, &G(u_current, 1, local[1]), &G(u_current, 1, local[1] + 1), mat_column, east);
+
+    //----Computational core----//
+    gettimeofday(&tts, NULL); //Get Starting Time
+    gettimeofday(&tcs, NULL);
+
+    tw0 = MPI_Wtime();
+    halo_exchange(&halo);
+    tremap += MPI_Wtime() - tw0;
+    Residual(u_current, r, i_min, i_max, j_min, j_max);
+
+    //Transforms along j
+    tw0 = MPI_Wtime();
+    Remap(&to_rows, r->data, rows, 0, CART_COMM);
+    tremap += MPI_Wtime() - tw0;
+    Transform(&py, rows, re - rs);
+
+    //Transforms along i, divided by the eigenvalues, and back
+    tw0 = MPI_Wtime();
+    Remap(&to_cols, rows, cols, 0, CART_COMM);
+    tremap += MPI_Wtime() - tw0;
+    Transform(&px, cols, ce - cs);
+#   pragma omp parallel for private(i) schedule(static)
+    for (j = cs; j < ce; j++)
+        for (i = 0; i < nx; i++)
+            cols[(size_t)(j - cs) * nx + i] *= 4. / ((nx + 1) * (double)(ny + 1) * (lx[i] + ly[j - 1]));
+    Transform(&px, cols, ce - cs);
+    tw0 = MPI_Wtime();
+    Remap(&to_cols, rows, cols, 1, CART_COMM);
+    tremap += MPI_Wtime() - tw0;
+
+    //Transforms along j back to the blocks, the correction replaces r
+    Transform(&py, rows, re - rs);
+    tw0 = MPI_Wtime();
+    Remap(&to_rows, r->data, rows, 1, CART_COMM);
+    tremap += MPI_Wtime() - tw0;
+#   pragma omp parallel for private(j) schedule(static)
+    for (i = i_min; i < i_max; i++)
+        for (j = j_min; j < j_max; j++)
+            G(u_current, i, j) += G(r, i, j);
+
+    gettimeofday(&tcf, NULL);
+    tcomp = (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - tremap;
+
+    printf("Rank: %d,  Done Computing\n", rank);
+    gettimeofday(&ttf, NULL);
+
+    ttotal = (ttf.tv_sec - tts.tv_sec) + (ttf.tv_usec - tts.tv_usec) * 0.000001;
+
+    MPI_Barrier(MPI_COMM_WORLD); //Make sure all processes have finished computation
+
+    //The following reduction is for the time sum
+    MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&tremap, &remap_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+
+
+    //----Rank 0 gathers local matrices back to the global matrix----//
+    //----With output=binary nothing is gathered: every process writes its own block----//
+    if (rank == 0)
+        {
+            U = allocate2d(global[0], global[1], 0);
+        }
+
+
+    //All Processes send data back to rank0,  rank0 receives
+    //Every block is received into its place by a subarray datatype
+    if (!binary)
+        gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
+
+
+    //************************************//
+
+    //----Printing results----//
+
+#   ifdef PRINT_RESULTS
+    char * s = malloc(50 * sizeof(char));
+    double midpoint = probe2d(u_current, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#   endif
+
+    if (rank == 0)
+        {
+
+#   ifdef PRINT_RESULTS
+#   ifdef SINE
+            //No iterations: the result is the exact solution of the discrete problem
+            printf("SineTransform X %d Y %d Px %d Py %d Threads %d ComputationTime %lf TotalTime %lf midpoint %lf RemapTime %lf Halo %s\n", \
+                   global[0], global[1], grid[0], grid[1], threads, comp_time, total_time, midpoint, remap_time, nbr ? "nbr" : "p2p");
+            sprintf(s, "res%sMPI_%dx%d_%dx%d", "SineTransform", global[0], global[1], grid[0], grid[1]);
+#   endif
+
+            if (binary)
+                strcat(s, ".bin");
+            else
+                fprint2d(s, U, global[0], global[1]);
+#   endif
+
+        }
+#   ifdef PRINT_RESULTS
+    //Every process writes its block into the file rank 0 named
+    if (binary)
+        write2d(s, u_current, offset, global, hints, CART_COMM);
+    free(s);
+#   endif
+    if (hints != MPI_INFO_NULL)
+        MPI_Info_free(&hints);
+    halo_free(&halo);
+    RemapFree(&to_rows, size);
+    RemapFree(&to_cols, size);
+    dst_free(&px);
+    dst_free(&py);
+    MPI_Finalize();
+    return 0;
+}
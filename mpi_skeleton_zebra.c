@@ -0,0 +1,557 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "mpi.h"
+#include "utils.h"
+#include "decomp.h"
+#include "halo.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//Computational Kernels
+//Zebra line SOR: every row of a colour (odd global rows, then even ones) is
+//solved exactly for its neighbour rows, 4 u[j] - u[j - 1] - u[j + 1] =
+//north[j] + south[j], and moved by omega towards that solution. A row is
+//split among the processes of a row of the process grid: the last point of
+//every segment but the last one is a separator, the rest of segment p only
+//couples to separators p - 1 and p, so
+//  x = y + s[p - 1] alpha + s[p] beta,  T y = f,  T alpha = e_0,  T beta = e_n-1
+//with T = tridiag(-1, 4, -1) of the segment. Eliminating x from the separator
+//equations leaves a tridiagonal system of P - 1 separators (partition or SPIKE
+//method), whose matrix is the same for every row: every process solves it for
+//all rows of a colour after one MPI_Allgather of y[0], y[n - 1] and the
+//separator right-hand side along the process row
+typedef struct
+{
+    MPI_Comm comm;           //processes sharing the rows, in column order
+    int P, p;                //their number and the position of this one
+    int n;                   //points of the segment before the separator
+    int left, right;         //there is a separator to the left, this process owns one on its right
+    double * dinv;           //Thomas factorisation of T: inverse pivots, the multipliers are -dinv
+    double * alpha, * beta;  //response of the segment to a unit left/right separator
+    double * rdinv, * rlow, * rup; //factorised separator system: inverse pivots, sub- and super-diagonal
+} zebra2d;
+
+//In-place Thomas solve of T y = f, dinv from LineFactor
+static inline void LineSolve(int n, const double * dinv, double * y)
+{
+    int j;
+    y[0] *= dinv[0];
+    for (j = 1; j < n; j++)
+        y[j] = (y[j] + y[j - 1]) * dinv[j];
+    for (j = n - 2; j >= 0; j--)
+        y[j] += y[j + 1] * dinv[j];
+}
+
+void LineFactor(int n, double * dinv)
+{
+    int j;
+    dinv[0] = 0.25;
+    for (j = 1; j < n; j++)
+        dinv[j] = 1 / (4 - dinv[j - 1]);
+}
+
+//Segment of n points on process p of comm, with a separator after it unless p
+//is the last one; all processes of comm call it
+void ZebraCreate(zebra2d * z, MPI_Comm comm, int n)
+{
+    int q;
+    double mine[4], * all;
+
+    z->comm = comm;
+    MPI_Comm_size(comm, &z->P);
+    MPI_Comm_rank(comm, &z->p);
+    z->left = (z->p > 0);
+    z->right = (z->p < z->P - 1);
+    z->n = n - z->right;
+    z->dinv = (double*)malloc(z->n * sizeof(double));
+    z->alpha = (double*)calloc(z->n, sizeof(double));
+    z->beta = (double*)calloc(z->n, sizeof(double));
+    LineFactor(z->n, z->dinv);
+    if (z->left)
+        {
+            z->alpha[0] = 1;
+            LineSolve(z->n, z->dinv, z->alpha);
+        }
+    if (z->right)
+        {
+            z->beta[z->n - 1] = 1;
+            LineSolve(z->n, z->dinv, z->beta);
+        }
+
+    //Separator q sits between segments q and q + 1:
+    //-alpha_q[n - 1] s[q - 1] + (4 - beta_q[n - 1] - alpha_q+1[0]) s[q] - beta_q+1[0] s[q + 1]
+    z->rdinv = (double*)malloc(z->P * sizeof(double));
+    z->rlow = (double*)malloc(z->P * sizeof(double));
+    z->rup = (double*)malloc(z->P * sizeof(double));
+    all = (double*)malloc(4 * z->P * sizeof(double));
+    mine[0] = z->alpha[0];
+    mine[1] = z->beta[0];
+    mine[2] = z->alpha[z->n - 1];
+    mine[3] = z->beta[z->n - 1];
+    MPI_Allgather(mine, 4, MPI_DOUBLE, all, 4, MPI_DOUBLE, comm);
+    for (q = 0; q < z->P - 1; q++)
+        {
+            z->rlow[q] = -all[4 * q + 2];
+            z->rup[q] = -all[4 * (q + 1) + 1];
+            z->rdinv[q] = 1 / (4 - all[4 * q + 3] - all[4 * (q + 1)] - ((q > 0) ? z->rlow[q] * z->rup[q - 1] * z->rdinv[q - 1] : 0));
+        }
+    free(all);
+}
+
+void ZebraFree(zebra2d * z)
+{
+    free(z->dinv);
+    free(z->alpha);
+    free(z->beta);
+    free(z->rdinv);
+    free(z->rlow);
+    free(z->rup);
+}
+
+//First half of a colour phase: y = T^-1 f for the nl rows first, first + 2, ...
+//of columns [Y_min, Y_max), into y, and the values the separator system needs
+//in send, 3 per row
+void ZebraLocal(zebra2d * z, grid2d * u, grid2d * y, int first, int nl, int Y_min, int Y_max, double * send)
+{
+    int k;
+#   pragma omp parallel for schedule(static)
+    for (k = 0; k < nl; k++)
+        {
+            int i = first + 2 * k, j;
+            double * f = &G(y, i, Y_min);
+            for (j = 0; j < z->n; j++)
+                f[j] = G(u, i - 1, Y_min + j) + G(u, i + 1, Y_min + j);
+            //Fixed boundary values at the ends of the whole row
+            if (!z->left)
+                f[0] += G(u, i, Y_min - 1);
+            if (!z->right)
+                f[z->n - 1] += G(u, i, Y_max);
+            LineSolve(z->n, z->dinv, f);
+            send[3 * k] = f[0];
+            send[3 * k + 1] = f[z->n - 1];
+            send[3 * k + 2] = z->right ? G(u, i - 1, Y_max - 1) + G(u, i + 1, Y_max - 1) : 0;
+        }
+}
+
+//Second half: solve the separator system of every row from all, the send
+//buffers of the whole process row, and move the rows by omega towards their
+//solution. Returns the max-norm of the update
+double ZebraUpdate(zebra2d * z, grid2d * u, grid2d * y, int first, int nl, int Y_min, const double * all, double omega)
+{
+    int k;
+    double res = 0;
+#   pragma omp parallel reduction(max:res)
+    {
+        int i, j, q;
+        double d, v, sl, sr, * s = (double*)malloc(z->P * sizeof(double));
+#       pragma omp for schedule(static)
+        for (k = 0; k < nl; k++)
+            {
+                i = first + 2 * k;
+                sl = sr = 0;
+                if (z->P > 1)
+                    {
+                        //s[q] = g[q] + y_q[n - 1] + y_q+1[0], forward then back substitution
+                        for (q = 0; q < z->P - 1; q++)
+                            {
+                                s[q] = all[3 * (nl * q + k) + 2] + all[3 * (nl * q + k) + 1] + all[3 * (nl * (q + 1) + k)];
+                                if (q > 0)
+                                    s[q] -= z->rlow[q] * s[q - 1];
+                                s[q] *= z->rdinv[q];
+                            }
+                        for (q = z->P - 3; q >= z->p - 1 && q >= 0; q--)
+                            s[q] -= z->rup[q] * z->rdinv[q] * s[q + 1];
+                        sl = z->left ? s[z->p - 1] : 0;
+                        sr = z->right ? s[z->p] : 0;
+                    }
+                for (j = 0; j < z->n; j++)
+                    {
+                        v = G(y, i, Y_min + j) + sl * z->alpha[j] + sr * z->beta[j];
+                        d = omega * (v - G(u, i, Y_min + j));
+                        G(u, i, Y_min + j) += d;
+                        res = (fabs(d) > res) ? fabs(d) : res;
+                    }
+                if (z->right)
+                    {
+                        d = omega * (sr - G(u, i, Y_min + z->n));
+                        G(u, i, Y_min + z->n) += d;
+                        res = (fabs(d) > res) ? fabs(d) : res;
+                    }
+            }
+        free(s);
+    }
+    return res;
+}
+
+
+int main(int argc, char ** argv)
+{
+    int rank, size;
+    int global[2], local[2]; //global matrix dimensions and local matrix dimensions (2D-domain, 2D-subdomain)
+    int offset[2];          //global indices of the first row and column of the subdomain
+    int binary;             //output=binary: every process writes its block of a binary file, nothing is gathered
+    MPI_Info hints;         //MPI-IO hints of the binary output
+    int grid[2];            //processor grid dimensions
+    int i, t, c;
+    int global_converged = 0, converged = 0; //flags for convergence, global and per process
+    double omega;           //relaxation factor of the line updates
+    int threads = 1;        //OpenMP threads per process (hybrid mode)
+    int nbr;                //halo exchange backend: 0 point-to-point, 1 neighbourhood collective
+    conv_sched sched;       //when to test: every C iterations or adaptive
+    int check = 0;          //this iteration tests convergence
+    double res, global_res; //max-norm of the update of a test iteration, on this process and over all of them
+    int first[2], nl[2];    //first local row and number of rows of each colour
+    double * send, * all;   //separator system input of every row of a colour: own and of the process row
+    zebra2d zebra;
+
+    struct timeval tts, ttf, tcs, tcf; //Timers: total-tts,ttf, computation-tcs,tcf
+    double ttotal = 0, tcomp = 0, total_time, comp_time;
+    double tw0, tcomm = 0, comm_time; //Time spent in halo exchanges
+    double tr0, trow = 0, row_time;   //Time spent gathering the separator systems
+
+    grid2d * U, * u_current, * y; //Global matrix, local matrix and the local line solutions
+
+
+#   ifdef _OPENMP
+    //Hybrid mode: only the master thread of each team calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    if (provided < MPI_THREAD_FUNNELED)
+        fprintf(stderr, "MPI library does not support MPI_THREAD_FUNNELED\n");
+    threads = omp_get_max_threads();
+#   else
+    MPI_Init(&argc, &argv);
+#   endif
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    //----Read 2D-domain dimensions and process grid dimensions from stdin----//
+
+    if (argc < 5)
+        {
+            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py [omega=auto|w] [halo=p2p|nbr] [every=auto|iters] [cmin=iters] [cmax=iters] [output=text|binary] [cb=enable|disable|automatic] [cb_nodes=n] [cb_buffer=bytes]\n");
+            exit(-1);
+        }
+    else
+        {
+            global[0] = atoi(argv[1]);
+            global[1] = atoi(argv[2]);
+            grid[0] = atoi(argv[3]);
+            grid[1] = atoi(argv[4]);
+        }
+
+    //----Create 2D-cartesian communicator----//
+    //----Usage of the cartesian communicator is optional----//
+
+    MPI_Comm CART_COMM;         //CART_COMM: the new 2D-cartesian communicator
+    int periods[2] = {0, 0};    //periods={0,0}: the 2D-grid is non-periodic
+    int rank_grid[2];           //rank_grid: the position of each process on the new communicator
+
+    MPI_Cart_create(MPI_COMM_WORLD, 2, grid, periods, 0, &CART_COMM); //communicator creation
+    MPI_Cart_coords(CART_COMM, rank, 2, rank_grid);                 //rank mapping on the new communicator
+
+    //Processes of the same process row share the grid rows
+    MPI_Comm ROW_COMM;
+    int remain[2] = {0, 1};
+    MPI_Cart_sub(CART_COMM, remain, &ROW_COMM);
+
+    MPI_Barrier(CART_COMM);
+    MPI_Barrier(MPI_COMM_WORLD);
+    //----Compute local 2D-subdomain dimensions----//
+    //----If the 2D-domain cannot be equally distributed, the first processes get a row/column more----//
+
+    for (i = 0; i < 2; i++)
+        {
+            local[i] = block_size(global[i], grid[i], rank_grid[i]);
+            offset[i] = block_start(global[i], grid[i], rank_grid[i]);
+        }
+
+    nbr = strcmp(option_str(argc, argv, "halo", "p2p"), "nbr") == 0;
+    if (!nbr && strcmp(option_str(argc, argv, "halo", "p2p"), "p2p") != 0)
+        {
+            fprintf(stderr, "halo must be p2p or nbr\n");
+            exit(-1);
+        }
+
+    binary = strcmp(option_str(argc, argv, "output", "text"), "binary") == 0;
+    if (!binary && strcmp(option_str(argc, argv, "output", "text"), "text") != 0)
+        {
+            fprintf(stderr, "output must be text or binary\n");
+            exit(-1);
+        }
+    hints = output_hints(argc, argv);
+
+    //every=n tests every n iterations, every=auto (the default) places each test
+    //where the decay of the update norm predicts convergence, cmin to cmax apart
+    sched_init(&sched, strcmp(option_str(argc, argv, "every", "auto"), "auto") == 0 ? 0 : option_int(argc, argv, "every", C), \
+               option_int(argc, argv, "cmin", C / 10), option_int(argc, argv, "cmax", 10 * C));
+
+    //omega=auto (the default): the optimum for the spectral radius of line
+    //Jacobi along rows, known for the 5-point operator on a rectangle
+    if (strcmp(option_str(argc, argv, "omega", "auto"), "auto") == 0)
+        omega = sor_omega(cos(M_PI / (global[0] - 1)) / (2 - cos(M_PI / (global[1] - 1))));
+    else
+        omega = atof(option_str(argc, argv, "omega", "auto"));
+
+
+    //----Allocate local 2D-subdomain u_current and the line solutions----//
+    //----Add a row/column on each size for ghost cells----//
+
+    u_current = allocate2d(local[0], local[1], 1);
+    y = allocate2d(local[0], local[1], 1);
+
+    //----Every process initializes the interior of its own block from its global position----//
+
+    init_block2d(u_current, offset[0], offset[1]);
+
+    //----Define datatypes or allocate buffers for message passing----//
+
+    MPI_Datatype mat_row;
+    MPI_Type_contiguous(local[1], MPI_DOUBLE, &mat_row);
+    MPI_Type_commit(&mat_row);
+
+    //----Find the 4 neighbors with which a process exchanges messages----//
+
+    int north, south, east, west;
+    north = -1;
+    south = -1;
+    east = -1;
+    west = -1;
+
+    //Try to get north Process
+    if (rank_grid[0] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0] - 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos , &north);
+        }
+
+    //Try to get south Process
+    if (rank_grid[0] + 1 <= grid[0] - 1)
+        {
+            int npos[2] = {rank_grid[0] + 1, rank_grid[1]};
+            MPI_Cart_rank(CART_COMM, npos, &south);
+        }
+
+    //Try to get east Process
+    if (rank_grid[1] + 1 <= grid[1] - 1)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] + 1};
+            MPI_Cart_rank(CART_COMM, npos, &east);
+        }
+
+    //Try to get west Process
+    if (rank_grid[1] - 1 >= 0)
+        {
+            int npos[2] = {rank_grid[0], rank_grid[1] - 1};
+            MPI_Cart_rank(CART_COMM, npos, &west);
+        }
+
+
+    //---Define the iteration ranges per process-----//
+
+    int i_min, i_max, j_min, j_max;
+
+    /*Two types of ranges over the local[0] x local[1] block (block_size):
+        -internal processes
+        -boundary processes, whose first or last row or column is the global boundary
+    */
+
+    //Init Values for internal processes
+    i_min = 1;
+    i_max = local[0] + 1;
+
+    j_min = 1;
+    j_max = local[1] + 1;
+
+
+    //Fix stuff according to neighbors found
+    //This Should fix Boundary Processes
+    if (north == -1)
+        {
+            i_min += 1;
+        }
+    if (south == -1)
+        {
+            i_max -= 1;
+        }
+    if (west == -1)
+        {
+            j_min += 1;
+        }
+    if (east == -1)
+        {
+            j_max -= 1;
+        }
+
+    //A segment needs a point besides its separator
+    if (j_max - j_min < 1 + (east != -1))
+        {
+            fprintf(stderr, "Process %d: %d columns are too few for a line segment\n", rank, j_max - j_min);
+            MPI_Abort(MPI_COMM_WORLD, -1);
+        }
+
+
+    printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n", \
+           rank_grid[0], rank_grid[1], rank,  north, south, east, west, local[0] + 2, local[1] + 2, i_min, i_max, j_min, j_max);
+
+    //----Rows of each colour, by the parity of their global index----//
+    for (c = 0; c < 2; c++)
+        {
+            first[c] = i_min + ((offset[0] + i_min - 1 + c) % 2);
+            nl[c] = (i_max > first[c]) ? (i_max - first[c] + 1) / 2 : 0;
+        }
+    send = (double*)malloc(3 * (nl[0] > nl[1] ? nl[0] : nl[1]) * sizeof(double));
+    all = (double*)malloc(3 * grid[1] * (nl[0] > nl[1] ? nl[0] : nl[1]) * sizeof(double));
+    ZebraCreate(&zebra, ROW_COMM, j_max - j_min);
+
+    //----Persistent halo exchange of the rows only: a line solve needs----//
+    //----the rows above and below it, the columns are coupled by the separators----//
+    halo2d halo;
+    halo_init(&halo, CART_COMM, nbr);
+    halo_side(&halo, HALO_NORTH, &G(u_current, 1, 1), &G(u_current, 0, 1), mat_row, north);
+    halo_side(&halo, HALO_SOUTH, &G(u_current, local[0], 1), &G(u_current, local[0] + 1, 1), mat_row, south);
+
+    //----Computational core----//
+    gettimeofday(&tts, NULL); //Get Starting Time
+
+#   ifdef TEST_CONV
+    for (t = 0; t < T && !global_converged; t++)
+        {
+#   endif
+#   ifndef TEST_CONV
+#   undef T
+#   define T 65536
+            for (t = 0; t < T; t++)
+                {
+#   endif
+
+#               ifdef TEST_CONV
+                    check = sched_due(&sched, t);
+#               endif
+
+                    //Start Computation
+                    /*Add appropriate timers for computation*/
+                    gettimeofday(&tcs, NULL);
+                    tw0 = tcomm;
+                    tr0 = trow;
+                    res = 0;
+
+                    //Computational Kernels
+                    //Odd rows first, then even ones, each after the rows of the other colour arrived
+                    for (c = 1; c >= 0; c--)
+                        {
+                            comm_time = MPI_Wtime();
+                            halo_exchange(&halo);
+                            tcomm += MPI_Wtime() - comm_time;
+                            ZebraLocal(&zebra, u_current, y, first[c], nl[c], j_min, j_max, send);
+                            row_time = MPI_Wtime();
+                            if (grid[1] > 1)
+                                MPI_Allgather(send, 3 * nl[c], MPI_DOUBLE, all, 3 * nl[c], MPI_DOUBLE, ROW_COMM);
+                            trow += MPI_Wtime() - row_time;
+                            res = max(res, ZebraUpdate(&zebra, u_current, y, first[c], nl[c], j_min, (grid[1] > 1) ? all : send, omega));
+                        }
+
+                    gettimeofday(&tcf, NULL);
+                    tcomp = (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001 - (tcomm - tw0) - (trow - tr0)) / 2.;
+
+#               ifdef TEST_CONV
+                    if (check)
+                        {
+                            //*************TODO**************//
+                            /*Test convergence*/
+                            //Same test as converge(): no point moved by more than e
+                            converged = (res <= e);
+                            if (converged)
+                                printf("Process: %d Converged\n", rank);
+                            //The global norm, not just the flag, so that every process
+                            //schedules the next test at the same iteration
+                            sched_start(&sched, t);
+                            MPI_Allreduce(&res, &global_res, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                            sched_update(&sched, t, global_res);
+                            global_converged = (global_res <= e);
+                        }
+#               endif
+
+                    //************************************//
+
+                }
+            printf("Rank: %d,  Done Computing\n", rank);
+            gettimeofday(&ttf, NULL);
+
+            ttotal = (ttf.tv_sec - tts.tv_sec) + (ttf.tv_usec - tts.tv_usec) * 0.000001;
+
+            MPI_Barrier(MPI_COMM_WORLD); //Make sure all processes have finished computation
+
+            //The following reduction is for the time sum
+            MPI_Reduce(&ttotal, &total_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomp, &comp_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&tcomm, &comm_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&trow, &row_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+
+
+            //----Rank 0 gathers local matrices back to the global matrix----//
+            //----With output=binary nothing is gathered: every process writes its own block----//
+            if (rank == 0)
+                {
+                    U = binary ? NULL : allocate2d(global[0], global[1], 0);
+                    printf("Value of T : %d\n", T);
+                }
+
+
+            //All Processes send data back to rank0,  rank0 receives
+            //Every block is received into its place by a subarray datatype
+            if (!binary)
+                gather2d((rank == 0) ? U : NULL, u_current, global, CART_COMM);
+
+
+            //************************************//
+
+            //----Printing results----//
+
+#           ifdef PRINT_RESULTS
+            char * s = malloc(50 * sizeof(char));
+            double midpoint = probe2d(u_current, offset, global[0] / 2, global[1] / 2, CART_COMM);
+#           endif
+
+            if (rank == 0)
+                {
+
+#           ifdef PRINT_RESULTS
+#           ifdef ZEBRA
+                    //RowTime: slowest process, gathering the separator systems
+                    printf("ZebraLine X %d Y %d Px %d Py %d Threads %d Iter %d ComputationTime %lf TotalTime %lf midpoint %lf Omega %lf RowTime %lf CommTime %lf Halo %s\n", \
+                           global[0], global[1], grid[0], grid[1], threads, t, comp_time, total_time, midpoint, \
+                           omega, row_time, comm_time / size, nbr ? "nbr" : "p2p");
+                    sprintf(s, "res%sMPI_%dx%d_%dx%d", "ZebraLine", global[0], global[1], grid[0], grid[1]);
+#           endif
+
+                    if (binary)
+                        strcat(s, ".bin");
+                    else
+                        fprint2d(s, U, global[0], global[1]);
+#           endif
+#           ifdef TEST_CONV
+                    //Wasted: estimated iterations between reaching e and the test that saw it
+                    printf("Convergence sync Every %d Checks %d Wasted %d\n", sched.every, sched.checks, sched.wasted);
+#           endif
+
+                }
+#           ifdef PRINT_RESULTS
+            //Every process writes its block into the file rank 0 named
+            if (binary)
+                write2d(s, u_current, offset, global, hints, CART_COMM);
+            free(s);
+#           endif
+            if (hints != MPI_INFO_NULL)
+                MPI_Info_free(&hints);
+            halo_free(&halo);
+            ZebraFree(&zebra);
+            MPI_Finalize();
+            return 0;
+
+        }
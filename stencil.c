@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include "utils.h"
+#include "stencil.h"
+
+//The descriptor of a fixed stencil lists the same points as its macro, so the
+//generic kernels give the same iteration; STENCIL_GENERIC starts empty
+void stencil_init ( stencil2d * st, int kind )
+{
+    int di, dj;
+    st->kind = STENCIL_GENERIC;
+    st->n = 0;
+    st->reach = 0;
+    st->corners = 0;
+    st->kcoef = NULL;
+    st->rhs = NULL;
+    for ( di = -1; di <= 1 && kind != STENCIL_GENERIC; di++ )
+        for ( dj = -1; dj <= 1; dj++ )
+            {
+                if ( di == 0 && dj == 0 )
+                    continue;
+                if ( kind == STENCIL_5 && di != 0 && dj != 0 )
+                    continue;
+                stencil_add ( st, di, dj, ( kind == STENCIL_5 ) ? 0.25 : ( di != 0 && dj != 0 ) ? 0.05 : 0.2, NULL );
+            }
+    st->kind = kind;
+}
+
+//Adds point (di, dj) with weight w, or with the weights in coef if it is set
+//A fixed stencil becomes a generic one
+void stencil_add ( stencil2d * st, int di, int dj, double w, grid2d * coef )
+{
+    int p = st->n++;
+    st->kind = STENCIL_GENERIC;
+    st->di[p] = di;
+    st->dj[p] = dj;
+    st->w[p] = w;
+    st->coef[p] = coef;
+    st->lower[p] = ( di < 0 || ( di == 0 && dj < 0 ) );
+    if ( abs ( di ) > st->reach )
+        st->reach = abs ( di );
+    if ( abs ( dj ) > st->reach )
+        st->reach = abs ( dj );
+    if ( di != 0 && dj != 0 )
+        st->corners = 1;
+}
+
+//Turns a 5-point stencil into div(k grad u) with the point values of k in kcoef,
+//which has the layout of the solution grid and covers its ghost cells
+void stencil_coef ( stencil2d * st, const float * kcoef )
+{
+    st->kind = STENCIL_VAR5 | ( st->kind & STENCIL_RHS );
+    st->kcoef = kcoef;
+}
+
+//Factor of -h^2 f in the update of point k, for the fixed kinds and the generic
+//descriptors of the fixed Laplacians: the inverse of the centre weight
+double stencil_scale ( const stencil2d * st, int s, size_t k )
+{
+    const float * c = st->kcoef;
+    switch ( st->kind & ~STENCIL_RHS )
+        {
+        case STENCIL_VAR5:
+            return 2.0 / ( 4 * c[k] + c[k - s] + c[k + s] + c[k - 1] + c[k + 1] );
+        case STENCIL_9:
+            return 0.3;
+        case STENCIL_GENERIC:
+            return st->corners ? 0.3 : 0.25;
+        default:
+            return 0.25;
+        }
+}
+
+//Adds the terms in rhs, laid out like kcoef, to every point
+void stencil_rhs ( stencil2d * st, const float * rhs )
+{
+    st->kind |= STENCIL_RHS;
+    st->rhs = rhs;
+}
+
+//The same stencil walked from its descriptor; variable coefficients become a
+//double grid of weights per point, shaped like like, the uncompressed layout
+//the single-precision STENCIL_VAR5 field is measured against
+void stencil_generic ( stencil2d * st, const grid2d * like )
+{
+    int i, j, p, rhs = st->kind & STENCIL_RHS;
+    if ( ( st->kind & ~STENCIL_RHS ) == STENCIL_VAR5 )
+        {
+            const int s = like->stride, di[4] = {-1, 1, 0, 0}, dj[4] = {0, 0, -1, 1};
+            const float * c = st->kcoef;
+            grid2d * w[4];
+            st->n = 0;
+            for ( p = 0; p < 4; p++ )
+                w[p] = allocate2d ( like->X, like->Y, like->ghost );
+            for ( i = 1; i < like->dimX - 1; i++ )
+                for ( j = 1; j < like->dimY - 1; j++ )
+                    {
+                        size_t k = ( size_t ) i * s + j;
+                        double d = 4 * c[k] + c[k - s] + c[k + s] + c[k - 1] + c[k + 1];
+                        for ( p = 0; p < 4; p++ )
+                            w[p]->data[k] = ( c[k] + c[k + di[p] * s + dj[p]] ) / d;
+                    }
+            for ( p = 0; p < 4; p++ )
+                stencil_add ( st, di[p], dj[p], 0, w[p] );
+        }
+    st->kind = STENCIL_GENERIC | rhs;
+}
+
+const char * stencil_name ( const stencil2d * st )
+{
+    static const char * names[2][4] = {{"5-point", "9-point", "variable", "generic"},
+        {"5-point+rhs", "9-point+rhs", "variable+rhs", "generic+rhs"}};
+    return names[( st->kind & STENCIL_RHS ) != 0][st->kind & ~STENCIL_RHS];
+}
@@ -0,0 +1,85 @@
+//Stencils of the relaxation kernels: a sweep sets every point to
+//u(i, j) = sum_p w[p] u(i + di[p], j + dj[p]), the weights already divided by
+//the centre one. A descriptor lists the points with constant weights, or with
+//a grid of weights per point for variable coefficients (then every grid has
+//the layout of the solution grid)
+//The 5-point and 9-point Laplacians also have single-point macros: a kernel
+//takes the kind as a constant argument and picks STENCIL_POINT, so each kind
+//is compiled into its own loop with constant offsets and weights, and the
+//descriptor is only walked for STENCIL_GENERIC
+//div(k grad u) = f is the 5-point STENCIL_VAR5, which reads the point values
+//of k from one single-precision field and averages them onto the faces: a
+//quarter of the traffic of four double weight grids. A right-hand side is a
+//single-precision field of the f terms, already scaled like the weights, that
+//the STENCIL_RHS flag of a kind adds to every point
+//Needs utils.h first, for grid2d
+
+#define STENCIL_MAX 9 //points of a descriptor
+#define STENCIL_RHS 8 //or-ed into a kind: the stencil adds its right-hand side
+
+enum { STENCIL_5, STENCIL_9, STENCIL_VAR5, STENCIL_GENERIC };
+
+typedef struct stencil2d
+{
+    int kind;                        //STENCIL_5 or STENCIL_9 for the fixed Laplacians, or-ed with STENCIL_RHS
+    int n;                           //points
+    int di[STENCIL_MAX], dj[STENCIL_MAX]; //offsets
+    double w[STENCIL_MAX];           //constant weights
+    grid2d * coef[STENCIL_MAX];      //variable weights, NULL for a constant point
+    int lower[STENCIL_MAX];          //the point precedes the centre in lexicographic order
+    int reach;                       //largest offset: ghost layers a step needs
+    int corners;                     //some point is a diagonal neighbour: halos need the corners
+    const float * kcoef;             //point coefficients of STENCIL_VAR5
+    const float * rhs;               //right-hand side terms
+} stencil2d;
+
+//One point of the fixed stencils at index k of arrays with row stride s: the
+//north and west neighbours (and the north corners) come from lo, the rest from
+//hi, so lo = hi gives Jacobi and lo = the current iterate Gauss-Seidel
+#define STENCIL5(lo, hi, s, k) (((lo)[(k) - (s)] + (hi)[(k) + (s)] + (lo)[(k) - 1] + (hi)[(k) + 1]) * 0.25)
+#define STENCIL9(lo, hi, s, k) ((((lo)[(k) - (s)] + (hi)[(k) + (s)] + (lo)[(k) - 1] + (hi)[(k) + 1]) * 4 + \
+                                 (lo)[(k) - (s) - 1] + (lo)[(k) - (s) + 1] + (hi)[(k) + (s) - 1] + (hi)[(k) + (s) + 1]) * 0.05)
+
+//The 7-point Laplacian of the 3D skeleton, on grids with planes p apart
+#define STENCIL7(lo, hi, p, s, k) (((lo)[(k) - (p)] + (hi)[(k) + (p)] + (lo)[(k) - (s)] + (hi)[(k) + (s)] + \
+                                   (lo)[(k) - 1] + (hi)[(k) + 1]) * (1.0 / 6))
+
+//Face coefficients are the sums of the two point values, their mean up to a
+//factor that cancels
+#define STENCILV5(lo, hi, c, s, k) (((c)[k] + (c)[(k) - (s)]) * (lo)[(k) - (s)] + ((c)[k] + (c)[(k) + (s)]) * (hi)[(k) + (s)] + \
+                                    ((c)[k] + (c)[(k) - 1]) * (lo)[(k) - 1] + ((c)[k] + (c)[(k) + 1]) * (hi)[(k) + 1]) / \
+                                   (4 * (c)[k] + (c)[(k) - (s)] + (c)[(k) + (s)] + (c)[(k) - 1] + (c)[(k) + 1])
+
+//Any stencil, specialised on a constant kind
+#define STENCIL_POINT(st, kind, lo, hi, s, k) ((((kind) & ~STENCIL_RHS) == STENCIL_5 ? STENCIL5(lo, hi, s, k) : \
+                                                ((kind) & ~STENCIL_RHS) == STENCIL_9 ? STENCIL9(lo, hi, s, k) : \
+                                                ((kind) & ~STENCIL_RHS) == STENCIL_VAR5 ? STENCILV5(lo, hi, (st)->kcoef, s, k) : \
+                                                stencil_eval ( st, lo, hi, s, k )) + (((kind) & STENCIL_RHS) ? (st)->rhs[k] : 0))
+
+//Calls f ( kind, ... ) with the kind of st as a constant
+#define STENCIL_CASES(st, f, ...) (((st)->kind & STENCIL_RHS) ? STENCIL_KINDS(st, STENCIL_RHS, f, __VA_ARGS__) : \
+                                   STENCIL_KINDS(st, 0, f, __VA_ARGS__))
+#define STENCIL_KINDS(st, r, f, ...) (((st)->kind & ~STENCIL_RHS) == STENCIL_5 ? f(STENCIL_5 | (r), __VA_ARGS__) : \
+                                      ((st)->kind & ~STENCIL_RHS) == STENCIL_9 ? f(STENCIL_9 | (r), __VA_ARGS__) : \
+                                      ((st)->kind & ~STENCIL_RHS) == STENCIL_VAR5 ? f(STENCIL_VAR5 | (r), __VA_ARGS__) : \
+                                      f(STENCIL_GENERIC | (r), __VA_ARGS__))
+
+//Homogeneous part of any stencil, walking the descriptor
+static inline double stencil_eval ( const stencil2d * st, const double * lo, const double * hi, int s, size_t k )
+{
+    int p;
+    double v = 0;
+    if ( ( st->kind & ~STENCIL_RHS ) == STENCIL_VAR5 )
+        return STENCILV5 ( lo, hi, st->kcoef, s, k );
+    for ( p = 0; p < st->n; p++ )
+        v += ( st->coef[p] ? st->coef[p]->data[k] : st->w[p] ) * ( st->lower[p] ? lo : hi ) [k + st->di[p] * s + st->dj[p]];
+    return v;
+}
+
+void stencil_init ( stencil2d * st, int kind );
+void stencil_add ( stencil2d * st, int di, int dj, double w, grid2d * coef );
+void stencil_coef ( stencil2d * st, const float * kcoef );
+double stencil_scale ( const stencil2d * st, int s, size_t k );
+void stencil_rhs ( stencil2d * st, const float * rhs );
+void stencil_generic ( stencil2d * st, const grid2d * like );
+const char * stencil_name ( const stencil2d * st );
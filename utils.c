@@ -1,5911 +1,556 @@
-# 1 "mpi_skeleton.c"
-# 1 "<built-in>"
-# 1 "<command-line>"
-# 1 "/usr/include/stdc-predef.h" 1 3 4
-# 1 "<command-line>" 2
-# 1 "mpi_skeleton.c"
-# 1 "/usr/include/stdio.h" 1 3 4
-# 27 "/usr/include/stdio.h" 3 4
-# 1 "/usr/include/features.h" 1 3 4
-# 374 "/usr/include/features.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
-# 385 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
-# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
-# 375 "/usr/include/features.h" 2 3 4
-# 398 "/usr/include/features.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
-# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
-# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
-# 399 "/usr/include/features.h" 2 3 4
-# 28 "/usr/include/stdio.h" 2 3 4
-
-
-
-
-
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 212 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 3 4
-typedef long unsigned int size_t;
-# 34 "/usr/include/stdio.h" 2 3 4
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
-# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
-# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
-
-
-typedef unsigned char __u_char;
-typedef unsigned short int __u_short;
-typedef unsigned int __u_int;
-typedef unsigned long int __u_long;
-
-
-typedef signed char __int8_t;
-typedef unsigned char __uint8_t;
-typedef signed short int __int16_t;
-typedef unsigned short int __uint16_t;
-typedef signed int __int32_t;
-typedef unsigned int __uint32_t;
-
-typedef signed long int __int64_t;
-typedef unsigned long int __uint64_t;
-
-
-
-
-
-
-
-typedef long int __quad_t;
-typedef unsigned long int __u_quad_t;
-# 121 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
-# 122 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
-
-
-typedef unsigned long int __dev_t;
-typedef unsigned int __uid_t;
-typedef unsigned int __gid_t;
-typedef unsigned long int __ino_t;
-typedef unsigned long int __ino64_t;
-typedef unsigned int __mode_t;
-typedef unsigned long int __nlink_t;
-typedef long int __off_t;
-typedef long int __off64_t;
-typedef int __pid_t;
-typedef struct { int __val[2]; } __fsid_t;
-typedef long int __clock_t;
-typedef unsigned long int __rlim_t;
-typedef unsigned long int __rlim64_t;
-typedef unsigned int __id_t;
-typedef long int __time_t;
-typedef unsigned int __useconds_t;
-typedef long int __suseconds_t;
-
-typedef int __daddr_t;
-typedef int __key_t;
-
-
-typedef int __clockid_t;
-
-
-typedef void * __timer_t;
-
-
-typedef long int __blksize_t;
-
-
-
-
-typedef long int __blkcnt_t;
-typedef long int __blkcnt64_t;
-
-
-typedef unsigned long int __fsblkcnt_t;
-typedef unsigned long int __fsblkcnt64_t;
-
-
-typedef unsigned long int __fsfilcnt_t;
-typedef unsigned long int __fsfilcnt64_t;
-
-
-typedef long int __fsword_t;
-
-typedef long int __ssize_t;
-
-
-typedef long int __syscall_slong_t;
-
-typedef unsigned long int __syscall_ulong_t;
-
-
-
-typedef __off64_t __loff_t;
-typedef __quad_t *__qaddr_t;
-typedef char *__caddr_t;
-
-
-typedef long int __intptr_t;
-
-
-typedef unsigned int __socklen_t;
-# 36 "/usr/include/stdio.h" 2 3 4
-# 44 "/usr/include/stdio.h" 3 4
-struct _IO_FILE;
-
-
-
-typedef struct _IO_FILE FILE;
-
-
-
-
-
-# 64 "/usr/include/stdio.h" 3 4
-typedef struct _IO_FILE __FILE;
-# 74 "/usr/include/stdio.h" 3 4
-# 1 "/usr/include/libio.h" 1 3 4
-# 31 "/usr/include/libio.h" 3 4
-# 1 "/usr/include/_G_config.h" 1 3 4
-# 15 "/usr/include/_G_config.h" 3 4
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 16 "/usr/include/_G_config.h" 2 3 4
-
-
-
-
-# 1 "/usr/include/wchar.h" 1 3 4
-# 82 "/usr/include/wchar.h" 3 4
-typedef struct
-{
-  int __count;
-  union
-  {
-
-    unsigned int __wch;
-
-
-
-    char __wchb[4];
-  } __value;
-} __mbstate_t;
-# 21 "/usr/include/_G_config.h" 2 3 4
-typedef struct
-{
-  __off_t __pos;
-  __mbstate_t __state;
-} _G_fpos_t;
-typedef struct
-{
-  __off64_t __pos;
-  __mbstate_t __state;
-} _G_fpos64_t;
-# 32 "/usr/include/libio.h" 2 3 4
-# 49 "/usr/include/libio.h" 3 4
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stdarg.h" 1 3 4
-# 40 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stdarg.h" 3 4
-typedef __builtin_va_list __gnuc_va_list;
-# 50 "/usr/include/libio.h" 2 3 4
-# 144 "/usr/include/libio.h" 3 4
-struct _IO_jump_t; struct _IO_FILE;
-# 154 "/usr/include/libio.h" 3 4
-typedef void _IO_lock_t;
-
-
-
-
-
-struct _IO_marker {
-  struct _IO_marker *_next;
-  struct _IO_FILE *_sbuf;
-
-
-
-  int _pos;
-# 177 "/usr/include/libio.h" 3 4
-};
-
-
-enum __codecvt_result
-{
-  __codecvt_ok,
-  __codecvt_partial,
-  __codecvt_error,
-  __codecvt_noconv
-};
-# 245 "/usr/include/libio.h" 3 4
-struct _IO_FILE {
-  int _flags;
-
-
-
-
-  char* _IO_read_ptr;
-  char* _IO_read_end;
-  char* _IO_read_base;
-  char* _IO_write_base;
-  char* _IO_write_ptr;
-  char* _IO_write_end;
-  char* _IO_buf_base;
-  char* _IO_buf_end;
-
-  char *_IO_save_base;
-  char *_IO_backup_base;
-  char *_IO_save_end;
-
-  struct _IO_marker *_markers;
-
-  struct _IO_FILE *_chain;
-
-  int _fileno;
-
-
-
-  int _flags2;
-
-  __off_t _old_offset;
-
-
-
-  unsigned short _cur_column;
-  signed char _vtable_offset;
-  char _shortbuf[1];
-
-
-
-  _IO_lock_t *_lock;
-# 293 "/usr/include/libio.h" 3 4
-  __off64_t _offset;
-# 302 "/usr/include/libio.h" 3 4
-  void *__pad1;
-  void *__pad2;
-  void *__pad3;
-  void *__pad4;
-  size_t __pad5;
-
-  int _mode;
-
-  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
-
-};
-
-
-typedef struct _IO_FILE _IO_FILE;
-
-
-struct _IO_FILE_plus;
-
-extern struct _IO_FILE_plus _IO_2_1_stdin_;
-extern struct _IO_FILE_plus _IO_2_1_stdout_;
-extern struct _IO_FILE_plus _IO_2_1_stderr_;
-# 338 "/usr/include/libio.h" 3 4
-typedef __ssize_t __io_read_fn (void *__cookie, char *__buf, size_t __nbytes);
-
-
-
-
-
-
-
-typedef __ssize_t __io_write_fn (void *__cookie, const char *__buf,
-     size_t __n);
-
-
-
-
-
-
-
-typedef int __io_seek_fn (void *__cookie, __off64_t *__pos, int __w);
-
-
-typedef int __io_close_fn (void *__cookie);
-# 390 "/usr/include/libio.h" 3 4
-extern int __underflow (_IO_FILE *);
-extern int __uflow (_IO_FILE *);
-extern int __overflow (_IO_FILE *, int);
-# 434 "/usr/include/libio.h" 3 4
-extern int _IO_getc (_IO_FILE *__fp);
-extern int _IO_putc (int __c, _IO_FILE *__fp);
-extern int _IO_feof (_IO_FILE *__fp) __attribute__ ((__nothrow__ , __leaf__));
-extern int _IO_ferror (_IO_FILE *__fp) __attribute__ ((__nothrow__ , __leaf__));
-
-extern int _IO_peekc_locked (_IO_FILE *__fp);
-
-
-
-
-
-extern void _IO_flockfile (_IO_FILE *) __attribute__ ((__nothrow__ , __leaf__));
-extern void _IO_funlockfile (_IO_FILE *) __attribute__ ((__nothrow__ , __leaf__));
-extern int _IO_ftrylockfile (_IO_FILE *) __attribute__ ((__nothrow__ , __leaf__));
-# 464 "/usr/include/libio.h" 3 4
-extern int _IO_vfscanf (_IO_FILE * __restrict, const char * __restrict,
-   __gnuc_va_list, int *__restrict);
-extern int _IO_vfprintf (_IO_FILE *__restrict, const char *__restrict,
-    __gnuc_va_list);
-extern __ssize_t _IO_padn (_IO_FILE *, int, __ssize_t);
-extern size_t _IO_sgetn (_IO_FILE *, void *, size_t);
-
-extern __off64_t _IO_seekoff (_IO_FILE *, __off64_t, int, int);
-extern __off64_t _IO_seekpos (_IO_FILE *, __off64_t, int);
-
-extern void _IO_free_backup_area (_IO_FILE *) __attribute__ ((__nothrow__ , __leaf__));
-# 75 "/usr/include/stdio.h" 2 3 4
-
-
-
-
-typedef __gnuc_va_list va_list;
-# 90 "/usr/include/stdio.h" 3 4
-typedef __off_t off_t;
-# 102 "/usr/include/stdio.h" 3 4
-typedef __ssize_t ssize_t;
-
-
-
-
-
-
-
-typedef _G_fpos_t fpos_t;
-
-
-
-
-# 164 "/usr/include/stdio.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
-# 165 "/usr/include/stdio.h" 2 3 4
-
-
-
-extern struct _IO_FILE *stdin;
-extern struct _IO_FILE *stdout;
-extern struct _IO_FILE *stderr;
-
-
-
-
-
-
-
-extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
-
-extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int renameat (int __oldfd, const char *__old, int __newfd,
-       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern FILE *tmpfile (void) __attribute__ ((__warn_unused_result__));
-# 209 "/usr/include/stdio.h" 3 4
-extern char *tmpnam (char *__s) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-extern char *tmpnam_r (char *__s) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-# 227 "/usr/include/stdio.h" 3 4
-extern char *tempnam (const char *__dir, const char *__pfx)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-
-
-extern int fclose (FILE *__stream);
-
-
-
-
-extern int fflush (FILE *__stream);
-
-# 252 "/usr/include/stdio.h" 3 4
-extern int fflush_unlocked (FILE *__stream);
-# 266 "/usr/include/stdio.h" 3 4
-
-
-
-
-
-
-extern FILE *fopen (const char *__restrict __filename,
-      const char *__restrict __modes) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern FILE *freopen (const char *__restrict __filename,
-        const char *__restrict __modes,
-        FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-# 295 "/usr/include/stdio.h" 3 4
-
-# 306 "/usr/include/stdio.h" 3 4
-extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-# 319 "/usr/include/stdio.h" 3 4
-extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
-  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
-      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
-         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern int fprintf (FILE *__restrict __stream,
-      const char *__restrict __format, ...);
-
-
-
-
-extern int printf (const char *__restrict __format, ...);
-
-extern int sprintf (char *__restrict __s,
-      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
-
-
-
-
-
-extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
-       __gnuc_va_list __arg);
-
-
-
-
-extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
-
-extern int vsprintf (char *__restrict __s, const char *__restrict __format,
-       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
-
-
-
-
-
-extern int snprintf (char *__restrict __s, size_t __maxlen,
-       const char *__restrict __format, ...)
-     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
-
-extern int vsnprintf (char *__restrict __s, size_t __maxlen,
-        const char *__restrict __format, __gnuc_va_list __arg)
-     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
-
-# 412 "/usr/include/stdio.h" 3 4
-extern int vdprintf (int __fd, const char *__restrict __fmt,
-       __gnuc_va_list __arg)
-     __attribute__ ((__format__ (__printf__, 2, 0)));
-extern int dprintf (int __fd, const char *__restrict __fmt, ...)
-     __attribute__ ((__format__ (__printf__, 2, 3)));
-
-
-
-
-
-
-
-
-extern int fscanf (FILE *__restrict __stream,
-     const char *__restrict __format, ...) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern int scanf (const char *__restrict __format, ...) __attribute__ ((__warn_unused_result__));
-
-extern int sscanf (const char *__restrict __s,
-     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
-# 443 "/usr/include/stdio.h" 3 4
-extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
-
-                          __attribute__ ((__warn_unused_result__));
-extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
-                         __attribute__ ((__warn_unused_result__));
-extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
-
-                      ;
-# 463 "/usr/include/stdio.h" 3 4
-
-
-
-
-
-
-
-
-extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
-      __gnuc_va_list __arg)
-     __attribute__ ((__format__ (__scanf__, 2, 0))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
-     __attribute__ ((__format__ (__scanf__, 1, 0))) __attribute__ ((__warn_unused_result__));
-
-
-extern int vsscanf (const char *__restrict __s,
-      const char *__restrict __format, __gnuc_va_list __arg)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
-# 494 "/usr/include/stdio.h" 3 4
-extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
-
-
-
-     __attribute__ ((__format__ (__scanf__, 2, 0))) __attribute__ ((__warn_unused_result__));
-extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
-
-     __attribute__ ((__format__ (__scanf__, 1, 0))) __attribute__ ((__warn_unused_result__));
-extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
-
-
-
-     __attribute__ ((__format__ (__scanf__, 2, 0)));
-# 522 "/usr/include/stdio.h" 3 4
-
-
-
-
-
-
-
-
-
-extern int fgetc (FILE *__stream);
-extern int getc (FILE *__stream);
-
-
-
-
-
-extern int getchar (void);
-
-# 550 "/usr/include/stdio.h" 3 4
-extern int getc_unlocked (FILE *__stream);
-extern int getchar_unlocked (void);
-# 561 "/usr/include/stdio.h" 3 4
-extern int fgetc_unlocked (FILE *__stream);
-
-
-
-
-
-
-
-
-
-
-
-extern int fputc (int __c, FILE *__stream);
-extern int putc (int __c, FILE *__stream);
-
-
-
-
-
-extern int putchar (int __c);
-
-# 594 "/usr/include/stdio.h" 3 4
-extern int fputc_unlocked (int __c, FILE *__stream);
-
-
-
-
-
-
-
-extern int putc_unlocked (int __c, FILE *__stream);
-extern int putchar_unlocked (int __c);
-
-
-
-
-
-
-extern int getw (FILE *__stream);
-
-
-extern int putw (int __w, FILE *__stream);
-
-
-
-
-
-
-
-
-extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
-     __attribute__ ((__warn_unused_result__));
-# 638 "/usr/include/stdio.h" 3 4
-extern char *gets (char *__s) __attribute__ ((__warn_unused_result__)) __attribute__ ((__deprecated__));
-
-
-# 665 "/usr/include/stdio.h" 3 4
-extern __ssize_t __getdelim (char **__restrict __lineptr,
-          size_t *__restrict __n, int __delimiter,
-          FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-extern __ssize_t getdelim (char **__restrict __lineptr,
-        size_t *__restrict __n, int __delimiter,
-        FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-
-extern __ssize_t getline (char **__restrict __lineptr,
-       size_t *__restrict __n,
-       FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-
-
-extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
-
-
-
-
-
-extern int puts (const char *__s);
-
-
-
-
-
-
-extern int ungetc (int __c, FILE *__stream);
-
-
-
-
-
-
-extern size_t fread (void *__restrict __ptr, size_t __size,
-       size_t __n, FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern size_t fwrite (const void *__restrict __ptr, size_t __size,
-        size_t __n, FILE *__restrict __s);
-
-# 737 "/usr/include/stdio.h" 3 4
-extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
-         size_t __n, FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
-          size_t __n, FILE *__restrict __stream);
-
-
-
-
-
-
-
-
-extern int fseek (FILE *__stream, long int __off, int __whence);
-
-
-
-
-extern long int ftell (FILE *__stream) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern void rewind (FILE *__stream);
-
-# 773 "/usr/include/stdio.h" 3 4
-extern int fseeko (FILE *__stream, __off_t __off, int __whence);
-
-
-
-
-extern __off_t ftello (FILE *__stream) __attribute__ ((__warn_unused_result__));
-# 792 "/usr/include/stdio.h" 3 4
-
-
-
-
-
-
-extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
-
-
-
-
-extern int fsetpos (FILE *__stream, const fpos_t *__pos);
-# 815 "/usr/include/stdio.h" 3 4
-
-# 824 "/usr/include/stdio.h" 3 4
-
-
-extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
-
-extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
-extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-
-
-extern void perror (const char *__s);
-
-
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/sys_errlist.h" 1 3 4
-# 26 "/usr/include/x86_64-linux-gnu/bits/sys_errlist.h" 3 4
-extern int sys_nerr;
-extern const char *const sys_errlist[];
-# 854 "/usr/include/stdio.h" 2 3 4
-
-
-
-
-extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-# 873 "/usr/include/stdio.h" 3 4
-extern FILE *popen (const char *__command, const char *__modes) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-extern int pclose (FILE *__stream);
-
-
-
-
-
-extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__));
-# 913 "/usr/include/stdio.h" 3 4
-extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
-# 934 "/usr/include/stdio.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
-# 43 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) int
-getchar (void)
-{
-  return _IO_getc (stdin);
-}
-
-
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-fgetc_unlocked (FILE *__fp)
-{
-  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
-}
-
-
-
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-getc_unlocked (FILE *__fp)
-{
-  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
-}
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-getchar_unlocked (void)
-{
-  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
-}
-
-
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-putchar (int __c)
-{
-  return _IO_putc (__c, stdout);
-}
-
-
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-fputc_unlocked (int __c, FILE *__stream)
-{
-  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
-}
-
-
-
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-putc_unlocked (int __c, FILE *__stream)
-{
-  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
-}
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-putchar_unlocked (int __c)
-{
-  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
-}
-# 124 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) int
-__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
-{
-  return (((__stream)->_flags & 0x10) != 0);
-}
-
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
-{
-  return (((__stream)->_flags & 0x20) != 0);
-}
-# 935 "/usr/include/stdio.h" 2 3 4
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/stdio2.h" 1 3 4
-# 23 "/usr/include/x86_64-linux-gnu/bits/stdio2.h" 3 4
-extern int __sprintf_chk (char *__restrict __s, int __flag, size_t __slen,
-     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
-extern int __vsprintf_chk (char *__restrict __s, int __flag, size_t __slen,
-      const char *__restrict __format,
-      __gnuc_va_list __ap) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-__attribute__ ((__nothrow__ , __leaf__)) sprintf (char *__restrict __s, const char *__restrict __fmt, ...)
-{
-  return __builtin___sprintf_chk (__s, 2 - 1,
-      __builtin_object_size (__s, 2 > 1), __fmt, __builtin_va_arg_pack ());
-}
-
-
-
-
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-__attribute__ ((__nothrow__ , __leaf__)) vsprintf (char *__restrict __s, const char *__restrict __fmt, __gnuc_va_list __ap)
-
-{
-  return __builtin___vsprintf_chk (__s, 2 - 1,
-       __builtin_object_size (__s, 2 > 1), __fmt, __ap);
-}
-
-
-
-extern int __snprintf_chk (char *__restrict __s, size_t __n, int __flag,
-      size_t __slen, const char *__restrict __format,
-      ...) __attribute__ ((__nothrow__ , __leaf__));
-extern int __vsnprintf_chk (char *__restrict __s, size_t __n, int __flag,
-       size_t __slen, const char *__restrict __format,
-       __gnuc_va_list __ap) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-__attribute__ ((__nothrow__ , __leaf__)) snprintf (char *__restrict __s, size_t __n, const char *__restrict __fmt, ...)
-
-{
-  return __builtin___snprintf_chk (__s, __n, 2 - 1,
-       __builtin_object_size (__s, 2 > 1), __fmt, __builtin_va_arg_pack ());
-}
-
-
-
-
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-__attribute__ ((__nothrow__ , __leaf__)) vsnprintf (char *__restrict __s, size_t __n, const char *__restrict __fmt, __gnuc_va_list __ap)
-
-{
-  return __builtin___vsnprintf_chk (__s, __n, 2 - 1,
-        __builtin_object_size (__s, 2 > 1), __fmt, __ap);
-}
-
-
-
-
-
-extern int __fprintf_chk (FILE *__restrict __stream, int __flag,
-     const char *__restrict __format, ...);
-extern int __printf_chk (int __flag, const char *__restrict __format, ...);
-extern int __vfprintf_chk (FILE *__restrict __stream, int __flag,
-      const char *__restrict __format, __gnuc_va_list __ap);
-extern int __vprintf_chk (int __flag, const char *__restrict __format,
-     __gnuc_va_list __ap);
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-fprintf (FILE *__restrict __stream, const char *__restrict __fmt, ...)
-{
-  return __fprintf_chk (__stream, 2 - 1, __fmt,
-   __builtin_va_arg_pack ());
-}
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-printf (const char *__restrict __fmt, ...)
-{
-  return __printf_chk (2 - 1, __fmt, __builtin_va_arg_pack ());
-}
-
-
-
-
-
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-vprintf (const char *__restrict __fmt, __gnuc_va_list __ap)
-{
-
-  return __vfprintf_chk (stdout, 2 - 1, __fmt, __ap);
-
-
-
-}
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-vfprintf (FILE *__restrict __stream,
-   const char *__restrict __fmt, __gnuc_va_list __ap)
-{
-  return __vfprintf_chk (__stream, 2 - 1, __fmt, __ap);
-}
-
-
-extern int __dprintf_chk (int __fd, int __flag, const char *__restrict __fmt,
-     ...) __attribute__ ((__format__ (__printf__, 3, 4)));
-extern int __vdprintf_chk (int __fd, int __flag,
-      const char *__restrict __fmt, __gnuc_va_list __arg)
-     __attribute__ ((__format__ (__printf__, 3, 0)));
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-dprintf (int __fd, const char *__restrict __fmt, ...)
-{
-  return __dprintf_chk (__fd, 2 - 1, __fmt,
-   __builtin_va_arg_pack ());
-}
-
-
-
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-vdprintf (int __fd, const char *__restrict __fmt, __gnuc_va_list __ap)
-{
-  return __vdprintf_chk (__fd, 2 - 1, __fmt, __ap);
-}
-# 227 "/usr/include/x86_64-linux-gnu/bits/stdio2.h" 3 4
-extern char *__gets_chk (char *__str, size_t) __attribute__ ((__warn_unused_result__));
-extern char *__gets_warn (char *__str) __asm__ ("" "gets")
-     __attribute__ ((__warn_unused_result__)) __attribute__((__warning__ ("please use fgets or getline instead, gets can't " "specify buffer size")))
-                               ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) __attribute__ ((__warn_unused_result__)) char *
-gets (char *__str)
-{
-  if (__builtin_object_size (__str, 2 > 1) != (size_t) -1)
-    return __gets_chk (__str, __builtin_object_size (__str, 2 > 1));
-  return __gets_warn (__str);
-}
-
-
-extern char *__fgets_chk (char *__restrict __s, size_t __size, int __n,
-     FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-extern char *__fgets_alias (char *__restrict __s, int __n, FILE *__restrict __stream) __asm__ ("" "fgets")
-
-                                        __attribute__ ((__warn_unused_result__));
-extern char *__fgets_chk_warn (char *__restrict __s, size_t __size, int __n, FILE *__restrict __stream) __asm__ ("" "__fgets_chk")
-
-
-     __attribute__ ((__warn_unused_result__)) __attribute__((__warning__ ("fgets called with bigger size than length " "of destination buffer")))
-                                 ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) __attribute__ ((__warn_unused_result__)) char *
-fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
-{
-  if (__builtin_object_size (__s, 2 > 1) != (size_t) -1)
-    {
-      if (!__builtin_constant_p (__n) || __n <= 0)
- return __fgets_chk (__s, __builtin_object_size (__s, 2 > 1), __n, __stream);
-
-      if ((size_t) __n > __builtin_object_size (__s, 2 > 1))
- return __fgets_chk_warn (__s, __builtin_object_size (__s, 2 > 1), __n, __stream);
-    }
-  return __fgets_alias (__s, __n, __stream);
-}
-
-extern size_t __fread_chk (void *__restrict __ptr, size_t __ptrlen,
-      size_t __size, size_t __n,
-      FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-extern size_t __fread_alias (void *__restrict __ptr, size_t __size, size_t __n, FILE *__restrict __stream) __asm__ ("" "fread")
-
-
-            __attribute__ ((__warn_unused_result__));
-extern size_t __fread_chk_warn (void *__restrict __ptr, size_t __ptrlen, size_t __size, size_t __n, FILE *__restrict __stream) __asm__ ("" "__fread_chk")
-
-
-
-
-     __attribute__ ((__warn_unused_result__)) __attribute__((__warning__ ("fread called with bigger size * nmemb than length " "of destination buffer")))
-                                 ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) __attribute__ ((__warn_unused_result__)) size_t
-fread (void *__restrict __ptr, size_t __size, size_t __n,
-       FILE *__restrict __stream)
-{
-  if (__builtin_object_size (__ptr, 0) != (size_t) -1)
-    {
-      if (!__builtin_constant_p (__size)
-   || !__builtin_constant_p (__n)
-   || (__size | __n) >= (((size_t) 1) << (8 * sizeof (size_t) / 2)))
- return __fread_chk (__ptr, __builtin_object_size (__ptr, 0), __size, __n, __stream);
-
-      if (__size * __n > __builtin_object_size (__ptr, 0))
- return __fread_chk_warn (__ptr, __builtin_object_size (__ptr, 0), __size, __n, __stream);
-    }
-  return __fread_alias (__ptr, __size, __n, __stream);
-}
-# 327 "/usr/include/x86_64-linux-gnu/bits/stdio2.h" 3 4
-extern size_t __fread_unlocked_chk (void *__restrict __ptr, size_t __ptrlen,
-        size_t __size, size_t __n,
-        FILE *__restrict __stream) __attribute__ ((__warn_unused_result__));
-extern size_t __fread_unlocked_alias (void *__restrict __ptr, size_t __size, size_t __n, FILE *__restrict __stream) __asm__ ("" "fread_unlocked")
-
-
-                     __attribute__ ((__warn_unused_result__));
-extern size_t __fread_unlocked_chk_warn (void *__restrict __ptr, size_t __ptrlen, size_t __size, size_t __n, FILE *__restrict __stream) __asm__ ("" "__fread_unlocked_chk")
-
-
-
-
-     __attribute__ ((__warn_unused_result__)) __attribute__((__warning__ ("fread_unlocked called with bigger size * nmemb than " "length of destination buffer")))
-                                        ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) __attribute__ ((__warn_unused_result__)) size_t
-fread_unlocked (void *__restrict __ptr, size_t __size, size_t __n,
-  FILE *__restrict __stream)
-{
-  if (__builtin_object_size (__ptr, 0) != (size_t) -1)
-    {
-      if (!__builtin_constant_p (__size)
-   || !__builtin_constant_p (__n)
-   || (__size | __n) >= (((size_t) 1) << (8 * sizeof (size_t) / 2)))
- return __fread_unlocked_chk (__ptr, __builtin_object_size (__ptr, 0), __size, __n,
-         __stream);
-
-      if (__size * __n > __builtin_object_size (__ptr, 0))
- return __fread_unlocked_chk_warn (__ptr, __builtin_object_size (__ptr, 0), __size, __n,
-       __stream);
-    }
-
-
-  if (__builtin_constant_p (__size)
-      && __builtin_constant_p (__n)
-      && (__size | __n) < (((size_t) 1) << (8 * sizeof (size_t) / 2))
-      && __size * __n <= 8)
-    {
-      size_t __cnt = __size * __n;
-      char *__cptr = (char *) __ptr;
-      if (__cnt == 0)
- return 0;
-
-      for (; __cnt > 0; --__cnt)
- {
-   int __c = (__builtin_expect (((__stream)->_IO_read_ptr >= (__stream)->_IO_read_end), 0) ? __uflow (__stream) : *(unsigned char *) (__stream)->_IO_read_ptr++);
-   if (__c == (-1))
-     break;
-   *__cptr++ = __c;
- }
-      return (__cptr - (char *) __ptr) / __size;
-    }
-
-  return __fread_unlocked_alias (__ptr, __size, __n, __stream);
-}
-# 938 "/usr/include/stdio.h" 2 3 4
-
-
-
-
-
-
-# 2 "mpi_skeleton.c" 2
-# 1 "/usr/include/stdlib.h" 1 3 4
-# 32 "/usr/include/stdlib.h" 3 4
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 324 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 3 4
-typedef int wchar_t;
-# 33 "/usr/include/stdlib.h" 2 3 4
-
-
-
-
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
-# 50 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 3 4
-typedef enum
-{
-  P_ALL,
-  P_PID,
-  P_PGID
-} idtype_t;
-# 42 "/usr/include/stdlib.h" 2 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
-# 64 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 3 4
-# 1 "/usr/include/endian.h" 1 3 4
-# 36 "/usr/include/endian.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
-# 37 "/usr/include/endian.h" 2 3 4
-# 60 "/usr/include/endian.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
-# 28 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
-# 29 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 2 3 4
-
-
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap-16.h" 1 3 4
-# 36 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 2 3 4
-# 44 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
-static __inline unsigned int
-__bswap_32 (unsigned int __bsx)
-{
-  return __builtin_bswap32 (__bsx);
-}
-# 108 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
-static __inline __uint64_t
-__bswap_64 (__uint64_t __bsx)
-{
-  return __builtin_bswap64 (__bsx);
-}
-# 61 "/usr/include/endian.h" 2 3 4
-# 65 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 2 3 4
-
-union wait
-  {
-    int w_status;
-    struct
-      {
-
- unsigned int __w_termsig:7;
- unsigned int __w_coredump:1;
- unsigned int __w_retcode:8;
- unsigned int:16;
-
-
-
-
-
-
-
-      } __wait_terminated;
-    struct
-      {
-
- unsigned int __w_stopval:8;
- unsigned int __w_stopsig:8;
- unsigned int:16;
-
-
-
-
-
-
-      } __wait_stopped;
-  };
-# 43 "/usr/include/stdlib.h" 2 3 4
-# 67 "/usr/include/stdlib.h" 3 4
-typedef union
-  {
-    union wait *__uptr;
-    int *__iptr;
-  } __WAIT_STATUS __attribute__ ((__transparent_union__));
-# 95 "/usr/include/stdlib.h" 3 4
-
-
-typedef struct
-  {
-    int quot;
-    int rem;
-  } div_t;
-
-
-
-typedef struct
-  {
-    long int quot;
-    long int rem;
-  } ldiv_t;
-
-
-
-
-
-
-
-__extension__ typedef struct
-  {
-    long long int quot;
-    long long int rem;
-  } lldiv_t;
-
-
-# 139 "/usr/include/stdlib.h" 3 4
-extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern double atof (const char *__nptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-
-extern int atoi (const char *__nptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-
-extern long int atol (const char *__nptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-__extension__ extern long long int atoll (const char *__nptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-extern double strtod (const char *__restrict __nptr,
-        char **__restrict __endptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-extern float strtof (const char *__restrict __nptr,
-       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-extern long double strtold (const char *__restrict __nptr,
-       char **__restrict __endptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-extern long int strtol (const char *__restrict __nptr,
-   char **__restrict __endptr, int __base)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-extern unsigned long int strtoul (const char *__restrict __nptr,
-      char **__restrict __endptr, int __base)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-__extension__
-extern long long int strtoq (const char *__restrict __nptr,
-        char **__restrict __endptr, int __base)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-__extension__
-extern unsigned long long int strtouq (const char *__restrict __nptr,
-           char **__restrict __endptr, int __base)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-__extension__
-extern long long int strtoll (const char *__restrict __nptr,
-         char **__restrict __endptr, int __base)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-__extension__
-extern unsigned long long int strtoull (const char *__restrict __nptr,
-     char **__restrict __endptr, int __base)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-# 276 "/usr/include/stdlib.h" 3 4
-
-extern __inline __attribute__ ((__gnu_inline__)) int
-__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
-{
-  return (int) strtol (__nptr, (char **) ((void *)0), 10);
-}
-extern __inline __attribute__ ((__gnu_inline__)) long int
-__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
-{
-  return strtol (__nptr, (char **) ((void *)0), 10);
-}
-
-
-
-
-__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
-__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
-{
-  return strtoll (__nptr, (char **) ((void *)0), 10);
-}
-
-# 305 "/usr/include/stdlib.h" 3 4
-extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-extern long int a64l (const char *__s)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
-# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-
-
-
-
-
-
-typedef __u_char u_char;
-typedef __u_short u_short;
-typedef __u_int u_int;
-typedef __u_long u_long;
-typedef __quad_t quad_t;
-typedef __u_quad_t u_quad_t;
-typedef __fsid_t fsid_t;
-
-
-
-
-typedef __loff_t loff_t;
-
-
-
-typedef __ino_t ino_t;
-# 60 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-typedef __dev_t dev_t;
-
-
-
-
-typedef __gid_t gid_t;
-
-
-
-
-typedef __mode_t mode_t;
-
-
-
-
-typedef __nlink_t nlink_t;
-
-
-
-
-typedef __uid_t uid_t;
-# 98 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-typedef __pid_t pid_t;
-
-
-
-
-
-typedef __id_t id_t;
-# 115 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-typedef __daddr_t daddr_t;
-typedef __caddr_t caddr_t;
-
-
-
-
-
-typedef __key_t key_t;
-# 132 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-# 1 "/usr/include/time.h" 1 3 4
-# 57 "/usr/include/time.h" 3 4
-
-
-typedef __clock_t clock_t;
-
-
-
-# 73 "/usr/include/time.h" 3 4
-
-
-typedef __time_t time_t;
-
-
-
-# 91 "/usr/include/time.h" 3 4
-typedef __clockid_t clockid_t;
-# 103 "/usr/include/time.h" 3 4
-typedef __timer_t timer_t;
-# 133 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
-# 146 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 147 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
-
-
-
-typedef unsigned long int ulong;
-typedef unsigned short int ushort;
-typedef unsigned int uint;
-# 194 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-typedef int int8_t __attribute__ ((__mode__ (__QI__)));
-typedef int int16_t __attribute__ ((__mode__ (__HI__)));
-typedef int int32_t __attribute__ ((__mode__ (__SI__)));
-typedef int int64_t __attribute__ ((__mode__ (__DI__)));
-
-
-typedef unsigned int u_int8_t __attribute__ ((__mode__ (__QI__)));
-typedef unsigned int u_int16_t __attribute__ ((__mode__ (__HI__)));
-typedef unsigned int u_int32_t __attribute__ ((__mode__ (__SI__)));
-typedef unsigned int u_int64_t __attribute__ ((__mode__ (__DI__)));
-
-typedef int register_t __attribute__ ((__mode__ (__word__)));
-# 219 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
-# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
-# 22 "/usr/include/x86_64-linux-gnu/bits/select.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
-# 23 "/usr/include/x86_64-linux-gnu/bits/select.h" 2 3 4
-# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/sigset.h" 1 3 4
-# 22 "/usr/include/x86_64-linux-gnu/bits/sigset.h" 3 4
-typedef int __sig_atomic_t;
-
-
-
-
-typedef struct
-  {
-    unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
-  } __sigset_t;
-# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
-
-
-
-typedef __sigset_t sigset_t;
-
-
-
-
-
-# 1 "/usr/include/time.h" 1 3 4
-# 120 "/usr/include/time.h" 3 4
-struct timespec
-  {
-    __time_t tv_sec;
-    __syscall_slong_t tv_nsec;
-  };
-# 44 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
-# 30 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
-struct timeval
-  {
-    __time_t tv_sec;
-    __suseconds_t tv_usec;
-  };
-# 46 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
-
-
-typedef __suseconds_t suseconds_t;
-
-
-
-
-
-typedef long int __fd_mask;
-# 64 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
-typedef struct
-  {
-
-
-
-
-
-
-    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
-
-
-  } fd_set;
-
-
-
-
-
-
-typedef __fd_mask fd_mask;
-# 96 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
-
-# 106 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
-extern int select (int __nfds, fd_set *__restrict __readfds,
-     fd_set *__restrict __writefds,
-     fd_set *__restrict __exceptfds,
-     struct timeval *__restrict __timeout);
-# 118 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
-extern int pselect (int __nfds, fd_set *__restrict __readfds,
-      fd_set *__restrict __writefds,
-      fd_set *__restrict __exceptfds,
-      const struct timespec *__restrict __timeout,
-      const __sigset_t *__restrict __sigmask);
-
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/select2.h" 1 3 4
-# 24 "/usr/include/x86_64-linux-gnu/bits/select2.h" 3 4
-extern long int __fdelt_chk (long int __d);
-extern long int __fdelt_warn (long int __d)
-  __attribute__((__warning__ ("bit outside of fd_set selected")));
-# 129 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
-
-
-
-# 220 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
-
-
-# 1 "/usr/include/x86_64-linux-gnu/sys/sysmacros.h" 1 3 4
-# 24 "/usr/include/x86_64-linux-gnu/sys/sysmacros.h" 3 4
-
-
-__extension__
-extern unsigned int gnu_dev_major (unsigned long long int __dev)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-__extension__
-extern unsigned int gnu_dev_minor (unsigned long long int __dev)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-__extension__
-extern unsigned long long int gnu_dev_makedev (unsigned int __major,
-            unsigned int __minor)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-__extension__ extern __inline __attribute__ ((__gnu_inline__)) __attribute__ ((__const__)) unsigned int
-__attribute__ ((__nothrow__ , __leaf__)) gnu_dev_major (unsigned long long int __dev)
-{
-  return ((__dev >> 8) & 0xfff) | ((unsigned int) (__dev >> 32) & ~0xfff);
-}
-
-__extension__ extern __inline __attribute__ ((__gnu_inline__)) __attribute__ ((__const__)) unsigned int
-__attribute__ ((__nothrow__ , __leaf__)) gnu_dev_minor (unsigned long long int __dev)
-{
-  return (__dev & 0xff) | ((unsigned int) (__dev >> 12) & ~0xff);
-}
-
-__extension__ extern __inline __attribute__ ((__gnu_inline__)) __attribute__ ((__const__)) unsigned long long int
-__attribute__ ((__nothrow__ , __leaf__)) gnu_dev_makedev (unsigned int __major, unsigned int __minor)
-{
-  return ((__minor & 0xff) | ((__major & 0xfff) << 8)
-   | (((unsigned long long int) (__minor & ~0xff)) << 12)
-   | (((unsigned long long int) (__major & ~0xfff)) << 32));
-}
-
-
-# 223 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
-
-
-
-
-
-typedef __blksize_t blksize_t;
-
-
-
-
-
-
-typedef __blkcnt_t blkcnt_t;
-
-
-
-typedef __fsblkcnt_t fsblkcnt_t;
-
-
-
-typedef __fsfilcnt_t fsfilcnt_t;
-# 270 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
-# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
-# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
-# 60 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
-typedef unsigned long int pthread_t;
-
-
-union pthread_attr_t
-{
-  char __size[56];
-  long int __align;
-};
-
-typedef union pthread_attr_t pthread_attr_t;
-
-
-
-
-
-typedef struct __pthread_internal_list
-{
-  struct __pthread_internal_list *__prev;
-  struct __pthread_internal_list *__next;
-} __pthread_list_t;
-# 90 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
-typedef union
-{
-  struct __pthread_mutex_s
-  {
-    int __lock;
-    unsigned int __count;
-    int __owner;
-
-    unsigned int __nusers;
-
-
-
-    int __kind;
-
-    short __spins;
-    short __elision;
-    __pthread_list_t __list;
-# 124 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
-  } __data;
-  char __size[40];
-  long int __align;
-} pthread_mutex_t;
-
-typedef union
-{
-  char __size[4];
-  int __align;
-} pthread_mutexattr_t;
-
-
-
-
-typedef union
-{
-  struct
-  {
-    int __lock;
-    unsigned int __futex;
-    __extension__ unsigned long long int __total_seq;
-    __extension__ unsigned long long int __wakeup_seq;
-    __extension__ unsigned long long int __woken_seq;
-    void *__mutex;
-    unsigned int __nwaiters;
-    unsigned int __broadcast_seq;
-  } __data;
-  char __size[48];
-  __extension__ long long int __align;
-} pthread_cond_t;
-
-typedef union
-{
-  char __size[4];
-  int __align;
-} pthread_condattr_t;
-
-
-
-typedef unsigned int pthread_key_t;
-
-
-
-typedef int pthread_once_t;
-
-
-
-
-
-typedef union
-{
-
-  struct
-  {
-    int __lock;
-    unsigned int __nr_readers;
-    unsigned int __readers_wakeup;
-    unsigned int __writer_wakeup;
-    unsigned int __nr_readers_queued;
-    unsigned int __nr_writers_queued;
-    int __writer;
-    int __shared;
-    unsigned long int __pad1;
-    unsigned long int __pad2;
-
-
-    unsigned int __flags;
-
-  } __data;
-# 211 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
-  char __size[56];
-  long int __align;
-} pthread_rwlock_t;
-
-typedef union
-{
-  char __size[8];
-  long int __align;
-} pthread_rwlockattr_t;
-
-
-
-
-
-typedef volatile int pthread_spinlock_t;
-
-
-
-
-typedef union
-{
-  char __size[32];
-  long int __align;
-} pthread_barrier_t;
-
-typedef union
-{
-  char __size[4];
-  int __align;
-} pthread_barrierattr_t;
-# 271 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
-
-
-
-# 315 "/usr/include/stdlib.h" 2 3 4
-
-
-
-
-
-
-extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern char *initstate (unsigned int __seed, char *__statebuf,
-   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-
-
-extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-
-
-struct random_data
-  {
-    int32_t *fptr;
-    int32_t *rptr;
-    int32_t *state;
-    int rand_type;
-    int rand_deg;
-    int rand_sep;
-    int32_t *end_ptr;
-  };
-
-extern int random_r (struct random_data *__restrict __buf,
-       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-extern int srandom_r (unsigned int __seed, struct random_data *__buf)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
-   size_t __statelen,
-   struct random_data *__restrict __buf)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
-
-extern int setstate_r (char *__restrict __statebuf,
-         struct random_data *__restrict __buf)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-
-
-
-extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
-
-extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
-extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
-extern long int nrand48 (unsigned short int __xsubi[3])
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
-extern long int jrand48 (unsigned short int __xsubi[3])
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
-extern unsigned short int *seed48 (unsigned short int __seed16v[3])
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-struct drand48_data
-  {
-    unsigned short int __x[3];
-    unsigned short int __old_x[3];
-    unsigned short int __c;
-    unsigned short int __init;
-    __extension__ unsigned long long int __a;
-
-  };
-
-
-extern int drand48_r (struct drand48_data *__restrict __buffer,
-        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-extern int erand48_r (unsigned short int __xsubi[3],
-        struct drand48_data *__restrict __buffer,
-        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern int lrand48_r (struct drand48_data *__restrict __buffer,
-        long int *__restrict __result)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-extern int nrand48_r (unsigned short int __xsubi[3],
-        struct drand48_data *__restrict __buffer,
-        long int *__restrict __result)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern int mrand48_r (struct drand48_data *__restrict __buffer,
-        long int *__restrict __result)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-extern int jrand48_r (unsigned short int __xsubi[3],
-        struct drand48_data *__restrict __buffer,
-        long int *__restrict __result)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-extern int seed48_r (unsigned short int __seed16v[3],
-       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-extern int lcong48_r (unsigned short int __param[7],
-        struct drand48_data *__buffer)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-
-
-
-
-
-
-extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__warn_unused_result__));
-
-extern void *calloc (size_t __nmemb, size_t __size)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-
-
-
-
-extern void *realloc (void *__ptr, size_t __size)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern void cfree (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-# 1 "/usr/include/alloca.h" 1 3 4
-# 24 "/usr/include/alloca.h" 3 4
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 25 "/usr/include/alloca.h" 2 3 4
-
-
-
-
-
-
-
-extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-# 493 "/usr/include/stdlib.h" 2 3 4
-
-
-
-
-
-extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-# 513 "/usr/include/stdlib.h" 3 4
-
-
-extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
-
-
-
-extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-# 530 "/usr/include/stdlib.h" 3 4
-
-
-
-
-
-extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-
-extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
-
-
-
-
-
-
-
-
-
-
-
-
-
-extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
-
-
-
-
-
-
-extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-
-# 578 "/usr/include/stdlib.h" 3 4
-extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-extern int setenv (const char *__name, const char *__value, int __replace)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-
-extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-
-extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
-# 606 "/usr/include/stdlib.h" 3 4
-extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-# 620 "/usr/include/stdlib.h" 3 4
-extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-# 642 "/usr/include/stdlib.h" 3 4
-extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-# 663 "/usr/include/stdlib.h" 3 4
-extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-# 712 "/usr/include/stdlib.h" 3 4
-
-
-
-
-
-extern int system (const char *__command) __attribute__ ((__warn_unused_result__));
-
-# 734 "/usr/include/stdlib.h" 3 4
-extern char *realpath (const char *__restrict __name,
-         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-typedef int (*__compar_fn_t) (const void *, const void *);
-# 752 "/usr/include/stdlib.h" 3 4
-
-
-
-extern void *bsearch (const void *__key, const void *__base,
-        size_t __nmemb, size_t __size, __compar_fn_t __compar)
-     __attribute__ ((__nonnull__ (1, 2, 5))) __attribute__ ((__warn_unused_result__));
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
-# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) void *
-bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
-  __compar_fn_t __compar)
-{
-  size_t __l, __u, __idx;
-  const void *__p;
-  int __comparison;
-
-  __l = 0;
-  __u = __nmemb;
-  while (__l < __u)
-    {
-      __idx = (__l + __u) / 2;
-      __p = (void *) (((const char *) __base) + (__idx * __size));
-      __comparison = (*__compar) (__key, __p);
-      if (__comparison < 0)
- __u = __idx;
-      else if (__comparison > 0)
- __l = __idx + 1;
-      else
- return (void *) __p;
-    }
-
-  return ((void *)0);
-}
-# 761 "/usr/include/stdlib.h" 2 3 4
-
-
-
-
-extern void qsort (void *__base, size_t __nmemb, size_t __size,
-     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
-# 775 "/usr/include/stdlib.h" 3 4
-extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) __attribute__ ((__warn_unused_result__));
-extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) __attribute__ ((__warn_unused_result__));
-
-
-
-__extension__ extern long long int llabs (long long int __x)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-
-
-
-extern div_t div (int __numer, int __denom)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) __attribute__ ((__warn_unused_result__));
-extern ldiv_t ldiv (long int __numer, long int __denom)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) __attribute__ ((__warn_unused_result__));
-
-
-
-
-__extension__ extern lldiv_t lldiv (long long int __numer,
-        long long int __denom)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) __attribute__ ((__warn_unused_result__));
-
-# 812 "/usr/include/stdlib.h" 3 4
-extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
-     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
-     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern char *gcvt (double __value, int __ndigit, char *__buf)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern char *qecvt (long double __value, int __ndigit,
-      int *__restrict __decpt, int *__restrict __sign)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) __attribute__ ((__warn_unused_result__));
-extern char *qfcvt (long double __value, int __ndigit,
-      int *__restrict __decpt, int *__restrict __sign)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) __attribute__ ((__warn_unused_result__));
-extern char *qgcvt (long double __value, int __ndigit, char *__buf)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) __attribute__ ((__warn_unused_result__));
-
-
-
-
-extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
-     int *__restrict __sign, char *__restrict __buf,
-     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
-extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
-     int *__restrict __sign, char *__restrict __buf,
-     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
-
-extern int qecvt_r (long double __value, int __ndigit,
-      int *__restrict __decpt, int *__restrict __sign,
-      char *__restrict __buf, size_t __len)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
-extern int qfcvt_r (long double __value, int __ndigit,
-      int *__restrict __decpt, int *__restrict __sign,
-      char *__restrict __buf, size_t __len)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
-
-
-
-
-
-
-extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern int mbtowc (wchar_t *__restrict __pwc,
-     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern size_t mbstowcs (wchar_t *__restrict __pwcs,
-   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
-
-extern size_t wcstombs (char *__restrict __s,
-   const wchar_t *__restrict __pwcs, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__warn_unused_result__));
-# 899 "/usr/include/stdlib.h" 3 4
-extern int getsubopt (char **__restrict __optionp,
-        char *const *__restrict __tokens,
-        char **__restrict __valuep)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) __attribute__ ((__warn_unused_result__));
-# 951 "/usr/include/stdlib.h" 3 4
-extern int getloadavg (double __loadavg[], int __nelem)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
-# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
-
-extern __inline __attribute__ ((__gnu_inline__)) double
-__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
-{
-  return strtod (__nptr, (char **) ((void *)0));
-}
-
-# 956 "/usr/include/stdlib.h" 2 3 4
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib.h" 1 3 4
-# 23 "/usr/include/x86_64-linux-gnu/bits/stdlib.h" 3 4
-extern char *__realpath_chk (const char *__restrict __name,
-        char *__restrict __resolved,
-        size_t __resolvedlen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-extern char *__realpath_alias (const char *__restrict __name, char *__restrict __resolved) __asm__ ("" "realpath") __attribute__ ((__nothrow__ , __leaf__))
-
-                                                 __attribute__ ((__warn_unused_result__));
-extern char *__realpath_chk_warn (const char *__restrict __name, char *__restrict __resolved, size_t __resolvedlen) __asm__ ("" "__realpath_chk") __attribute__ ((__nothrow__ , __leaf__))
-
-
-                                                __attribute__ ((__warn_unused_result__))
-     __attribute__((__warning__ ("second argument of realpath must be either NULL or at " "least PATH_MAX bytes long buffer")))
-                                      ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) __attribute__ ((__warn_unused_result__)) char *
-__attribute__ ((__nothrow__ , __leaf__)) realpath (const char *__restrict __name, char *__restrict __resolved)
-{
-  if (__builtin_object_size (__resolved, 2 > 1) != (size_t) -1)
-    {
-
-
-
-
-      return __realpath_chk (__name, __resolved, __builtin_object_size (__resolved, 2 > 1));
-    }
-
-  return __realpath_alias (__name, __resolved);
-}
-
-
-extern int __ptsname_r_chk (int __fd, char *__buf, size_t __buflen,
-       size_t __nreal) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-extern int __ptsname_r_alias (int __fd, char *__buf, size_t __buflen) __asm__ ("" "ptsname_r") __attribute__ ((__nothrow__ , __leaf__))
-
-     __attribute__ ((__nonnull__ (2)));
-extern int __ptsname_r_chk_warn (int __fd, char *__buf, size_t __buflen, size_t __nreal) __asm__ ("" "__ptsname_r_chk") __attribute__ ((__nothrow__ , __leaf__))
-
-
-     __attribute__ ((__nonnull__ (2))) __attribute__((__warning__ ("ptsname_r called with buflen bigger than " "size of buf")))
-                   ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) int
-__attribute__ ((__nothrow__ , __leaf__)) ptsname_r (int __fd, char *__buf, size_t __buflen)
-{
-  if (__builtin_object_size (__buf, 2 > 1) != (size_t) -1)
-    {
-      if (!__builtin_constant_p (__buflen))
- return __ptsname_r_chk (__fd, __buf, __buflen, __builtin_object_size (__buf, 2 > 1));
-      if (__buflen > __builtin_object_size (__buf, 2 > 1))
- return __ptsname_r_chk_warn (__fd, __buf, __buflen, __builtin_object_size (__buf, 2 > 1));
-    }
-  return __ptsname_r_alias (__fd, __buf, __buflen);
-}
-
-
-extern int __wctomb_chk (char *__s, wchar_t __wchar, size_t __buflen)
-  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__));
-extern int __wctomb_alias (char *__s, wchar_t __wchar) __asm__ ("" "wctomb") __attribute__ ((__nothrow__ , __leaf__))
-              __attribute__ ((__warn_unused_result__));
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) __attribute__ ((__warn_unused_result__)) int
-__attribute__ ((__nothrow__ , __leaf__)) wctomb (char *__s, wchar_t __wchar)
-{
-
-
-
-
-
-
-
-  if (__builtin_object_size (__s, 2 > 1) != (size_t) -1 && 16 > __builtin_object_size (__s, 2 > 1))
-    return __wctomb_chk (__s, __wchar, __builtin_object_size (__s, 2 > 1));
-  return __wctomb_alias (__s, __wchar);
-}
-
-
-extern size_t __mbstowcs_chk (wchar_t *__restrict __dst,
-         const char *__restrict __src,
-         size_t __len, size_t __dstlen) __attribute__ ((__nothrow__ , __leaf__));
-extern size_t __mbstowcs_alias (wchar_t *__restrict __dst, const char *__restrict __src, size_t __len) __asm__ ("" "mbstowcs") __attribute__ ((__nothrow__ , __leaf__))
-
-
-                                  ;
-extern size_t __mbstowcs_chk_warn (wchar_t *__restrict __dst, const char *__restrict __src, size_t __len, size_t __dstlen) __asm__ ("" "__mbstowcs_chk") __attribute__ ((__nothrow__ , __leaf__))
-
-
-
-     __attribute__((__warning__ ("mbstowcs called with dst buffer smaller than len " "* sizeof (wchar_t)")))
-                        ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) size_t
-__attribute__ ((__nothrow__ , __leaf__)) mbstowcs (wchar_t *__restrict __dst, const char *__restrict __src, size_t __len)
-
-{
-  if (__builtin_object_size (__dst, 2 > 1) != (size_t) -1)
-    {
-      if (!__builtin_constant_p (__len))
- return __mbstowcs_chk (__dst, __src, __len,
-          __builtin_object_size (__dst, 2 > 1) / sizeof (wchar_t));
-
-      if (__len > __builtin_object_size (__dst, 2 > 1) / sizeof (wchar_t))
- return __mbstowcs_chk_warn (__dst, __src, __len,
-         __builtin_object_size (__dst, 2 > 1) / sizeof (wchar_t));
-    }
-  return __mbstowcs_alias (__dst, __src, __len);
-}
-
-
-extern size_t __wcstombs_chk (char *__restrict __dst,
-         const wchar_t *__restrict __src,
-         size_t __len, size_t __dstlen) __attribute__ ((__nothrow__ , __leaf__));
-extern size_t __wcstombs_alias (char *__restrict __dst, const wchar_t *__restrict __src, size_t __len) __asm__ ("" "wcstombs") __attribute__ ((__nothrow__ , __leaf__))
-
-
-                                  ;
-extern size_t __wcstombs_chk_warn (char *__restrict __dst, const wchar_t *__restrict __src, size_t __len, size_t __dstlen) __asm__ ("" "__wcstombs_chk") __attribute__ ((__nothrow__ , __leaf__))
-
-
-
-     __attribute__((__warning__ ("wcstombs called with dst buffer smaller than len")));
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) size_t
-__attribute__ ((__nothrow__ , __leaf__)) wcstombs (char *__restrict __dst, const wchar_t *__restrict __src, size_t __len)
-
-{
-  if (__builtin_object_size (__dst, 2 > 1) != (size_t) -1)
-    {
-      if (!__builtin_constant_p (__len))
- return __wcstombs_chk (__dst, __src, __len, __builtin_object_size (__dst, 2 > 1));
-      if (__len > __builtin_object_size (__dst, 2 > 1))
- return __wcstombs_chk_warn (__dst, __src, __len, __builtin_object_size (__dst, 2 > 1));
-    }
-  return __wcstombs_alias (__dst, __src, __len);
-}
-# 960 "/usr/include/stdlib.h" 2 3 4
-# 968 "/usr/include/stdlib.h" 3 4
-
-# 3 "mpi_skeleton.c" 2
-# 1 "/usr/include/string.h" 1 3 4
-# 27 "/usr/include/string.h" 3 4
-
-
-
-
-
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 33 "/usr/include/string.h" 2 3 4
-# 44 "/usr/include/string.h" 3 4
-
-
-extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
-       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern void *memmove (void *__dest, const void *__src, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-
-
-
-extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
-        int __c, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-
-
-extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-extern int memcmp (const void *__s1, const void *__s2, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-# 96 "/usr/include/string.h" 3 4
-extern void *memchr (const void *__s, int __c, size_t __n)
-      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-
-
-# 127 "/usr/include/string.h" 3 4
-
-
-extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-extern char *strncpy (char *__restrict __dest,
-        const char *__restrict __src, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern char *strcat (char *__restrict __dest, const char *__restrict __src)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-extern char *strncat (char *__restrict __dest, const char *__restrict __src,
-        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern int strcmp (const char *__s1, const char *__s2)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-
-extern int strncmp (const char *__s1, const char *__s2, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern int strcoll (const char *__s1, const char *__s2)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-
-extern size_t strxfrm (char *__restrict __dest,
-         const char *__restrict __src, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-
-
-
-
-
-# 1 "/usr/include/xlocale.h" 1 3 4
-# 27 "/usr/include/xlocale.h" 3 4
-typedef struct __locale_struct
-{
-
-  struct __locale_data *__locales[13];
-
-
-  const unsigned short int *__ctype_b;
-  const int *__ctype_tolower;
-  const int *__ctype_toupper;
-
-
-  const char *__names[13];
-} *__locale_t;
-
-
-typedef __locale_t locale_t;
-# 164 "/usr/include/string.h" 2 3 4
-
-
-extern int strcoll_l (const char *__s1, const char *__s2, __locale_t __l)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
-
-extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
-    __locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
-
-
-
-
-
-extern char *strdup (const char *__s)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-
-extern char *strndup (const char *__string, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
-# 211 "/usr/include/string.h" 3 4
-
-# 236 "/usr/include/string.h" 3 4
-extern char *strchr (const char *__s, int __c)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-# 263 "/usr/include/string.h" 3 4
-extern char *strrchr (const char *__s, int __c)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-
-
-# 282 "/usr/include/string.h" 3 4
-
-
-
-extern size_t strcspn (const char *__s, const char *__reject)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern size_t strspn (const char *__s, const char *__accept)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-# 315 "/usr/include/string.h" 3 4
-extern char *strpbrk (const char *__s, const char *__accept)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-# 342 "/usr/include/string.h" 3 4
-extern char *strstr (const char *__haystack, const char *__needle)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-
-extern char *strtok (char *__restrict __s, const char *__restrict __delim)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-
-
-
-extern char *__strtok_r (char *__restrict __s,
-    const char *__restrict __delim,
-    char **__restrict __save_ptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
-
-extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
-         char **__restrict __save_ptr)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
-# 397 "/usr/include/string.h" 3 4
-
-
-extern size_t strlen (const char *__s)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-extern size_t strnlen (const char *__string, size_t __maxlen)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-
-extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
-
-# 427 "/usr/include/string.h" 3 4
-extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
-
-                        __attribute__ ((__nonnull__ (2)));
-# 445 "/usr/include/string.h" 3 4
-extern char *strerror_l (int __errnum, __locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern void __bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-extern void bcopy (const void *__src, void *__dest, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-extern int bcmp (const void *__s1, const void *__s2, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-# 489 "/usr/include/string.h" 3 4
-extern char *index (const char *__s, int __c)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-# 517 "/usr/include/string.h" 3 4
-extern char *rindex (const char *__s, int __c)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-# 534 "/usr/include/string.h" 3 4
-extern int strcasecmp (const char *__s1, const char *__s2)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
-# 557 "/usr/include/string.h" 3 4
-extern char *strsep (char **__restrict __stringp,
-       const char *__restrict __delim)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-
-extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-
-
-
-extern char *__stpncpy (char *__restrict __dest,
-   const char *__restrict __src, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-extern char *stpncpy (char *__restrict __dest,
-        const char *__restrict __src, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
-# 632 "/usr/include/string.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/string.h" 1 3 4
-# 633 "/usr/include/string.h" 2 3 4
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/string2.h" 1 3 4
-# 393 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern void *__rawmemchr (const void *__s, int __c);
-# 945 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) size_t __strcspn_c1 (const char *__s, int __reject);
-extern __inline __attribute__ ((__gnu_inline__)) size_t
-__strcspn_c1 (const char *__s, int __reject)
-{
-  size_t __result = 0;
-  while (__s[__result] != '\0' && __s[__result] != __reject)
-    ++__result;
-  return __result;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) size_t __strcspn_c2 (const char *__s, int __reject1,
-         int __reject2);
-extern __inline __attribute__ ((__gnu_inline__)) size_t
-__strcspn_c2 (const char *__s, int __reject1, int __reject2)
-{
-  size_t __result = 0;
-  while (__s[__result] != '\0' && __s[__result] != __reject1
-  && __s[__result] != __reject2)
-    ++__result;
-  return __result;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) size_t __strcspn_c3 (const char *__s, int __reject1,
-         int __reject2, int __reject3);
-extern __inline __attribute__ ((__gnu_inline__)) size_t
-__strcspn_c3 (const char *__s, int __reject1, int __reject2,
-       int __reject3)
-{
-  size_t __result = 0;
-  while (__s[__result] != '\0' && __s[__result] != __reject1
-  && __s[__result] != __reject2 && __s[__result] != __reject3)
-    ++__result;
-  return __result;
-}
-# 1021 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) size_t __strspn_c1 (const char *__s, int __accept);
-extern __inline __attribute__ ((__gnu_inline__)) size_t
-__strspn_c1 (const char *__s, int __accept)
-{
-  size_t __result = 0;
-
-  while (__s[__result] == __accept)
-    ++__result;
-  return __result;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) size_t __strspn_c2 (const char *__s, int __accept1,
-        int __accept2);
-extern __inline __attribute__ ((__gnu_inline__)) size_t
-__strspn_c2 (const char *__s, int __accept1, int __accept2)
-{
-  size_t __result = 0;
-
-  while (__s[__result] == __accept1 || __s[__result] == __accept2)
-    ++__result;
-  return __result;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) size_t __strspn_c3 (const char *__s, int __accept1,
-        int __accept2, int __accept3);
-extern __inline __attribute__ ((__gnu_inline__)) size_t
-__strspn_c3 (const char *__s, int __accept1, int __accept2, int __accept3)
-{
-  size_t __result = 0;
-
-  while (__s[__result] == __accept1 || __s[__result] == __accept2
-  || __s[__result] == __accept3)
-    ++__result;
-  return __result;
-}
-# 1097 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) char *__strpbrk_c2 (const char *__s, int __accept1,
-        int __accept2);
-extern __inline __attribute__ ((__gnu_inline__)) char *
-__strpbrk_c2 (const char *__s, int __accept1, int __accept2)
-{
-
-  while (*__s != '\0' && *__s != __accept1 && *__s != __accept2)
-    ++__s;
-  return *__s == '\0' ? ((void *)0) : (char *) (size_t) __s;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) char *__strpbrk_c3 (const char *__s, int __accept1,
-        int __accept2, int __accept3);
-extern __inline __attribute__ ((__gnu_inline__)) char *
-__strpbrk_c3 (const char *__s, int __accept1, int __accept2, int __accept3)
-{
-
-  while (*__s != '\0' && *__s != __accept1 && *__s != __accept2
-  && *__s != __accept3)
-    ++__s;
-  return *__s == '\0' ? ((void *)0) : (char *) (size_t) __s;
-}
-# 1147 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) char *__strtok_r_1c (char *__s, char __sep, char **__nextp);
-extern __inline __attribute__ ((__gnu_inline__)) char *
-__strtok_r_1c (char *__s, char __sep, char **__nextp)
-{
-  char *__result;
-  if (__s == ((void *)0))
-    __s = *__nextp;
-  while (*__s == __sep)
-    ++__s;
-  __result = ((void *)0);
-  if (*__s != '\0')
-    {
-      __result = __s++;
-      while (*__s != '\0')
- if (*__s++ == __sep)
-   {
-     __s[-1] = '\0';
-     break;
-   }
-    }
-  *__nextp = __s;
-  return __result;
-}
-# 1179 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern char *__strsep_g (char **__stringp, const char *__delim);
-# 1197 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern __inline __attribute__ ((__gnu_inline__)) char *__strsep_1c (char **__s, char __reject);
-extern __inline __attribute__ ((__gnu_inline__)) char *
-__strsep_1c (char **__s, char __reject)
-{
-  char *__retval = *__s;
-  if (__retval != ((void *)0) && (*__s = (__extension__ (__builtin_constant_p (__reject) && !__builtin_constant_p (__retval) && (__reject) == '\0' ? (char *) __rawmemchr (__retval, __reject) : __builtin_strchr (__retval, __reject)))) != ((void *)0))
-    *(*__s)++ = '\0';
-  return __retval;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) char *__strsep_2c (char **__s, char __reject1, char __reject2);
-extern __inline __attribute__ ((__gnu_inline__)) char *
-__strsep_2c (char **__s, char __reject1, char __reject2)
-{
-  char *__retval = *__s;
-  if (__retval != ((void *)0))
-    {
-      char *__cp = __retval;
-      while (1)
- {
-   if (*__cp == '\0')
-     {
-       __cp = ((void *)0);
-   break;
-     }
-   if (*__cp == __reject1 || *__cp == __reject2)
-     {
-       *__cp++ = '\0';
-       break;
-     }
-   ++__cp;
- }
-      *__s = __cp;
-    }
-  return __retval;
-}
-
-extern __inline __attribute__ ((__gnu_inline__)) char *__strsep_3c (char **__s, char __reject1, char __reject2,
-       char __reject3);
-extern __inline __attribute__ ((__gnu_inline__)) char *
-__strsep_3c (char **__s, char __reject1, char __reject2, char __reject3)
-{
-  char *__retval = *__s;
-  if (__retval != ((void *)0))
-    {
-      char *__cp = __retval;
-      while (1)
- {
-   if (*__cp == '\0')
-     {
-       __cp = ((void *)0);
-   break;
-     }
-   if (*__cp == __reject1 || *__cp == __reject2 || *__cp == __reject3)
-     {
-       *__cp++ = '\0';
-       break;
-     }
-   ++__cp;
- }
-      *__s = __cp;
-    }
-  return __retval;
-}
-# 1278 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern char *__strdup (const char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__));
-# 1297 "/usr/include/x86_64-linux-gnu/bits/string2.h" 3 4
-extern char *__strndup (const char *__string, size_t __n)
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__));
-# 636 "/usr/include/string.h" 2 3 4
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/string3.h" 1 3 4
-# 22 "/usr/include/x86_64-linux-gnu/bits/string3.h" 3 4
-extern void __warn_memset_zero_len (void) __attribute__((__warning__ ("memset used with constant zero length parameter; this could be due to transposed parameters")))
-                                                                                                   ;
-# 47 "/usr/include/x86_64-linux-gnu/bits/string3.h" 3 4
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) void *
-__attribute__ ((__nothrow__ , __leaf__)) memcpy (void *__restrict __dest, const void *__restrict __src, size_t __len)
-
-{
-  return __builtin___memcpy_chk (__dest, __src, __len, __builtin_object_size (__dest, 0));
-}
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) void *
-__attribute__ ((__nothrow__ , __leaf__)) memmove (void *__dest, const void *__src, size_t __len)
-{
-  return __builtin___memmove_chk (__dest, __src, __len, __builtin_object_size (__dest, 0));
-}
-# 75 "/usr/include/x86_64-linux-gnu/bits/string3.h" 3 4
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) void *
-__attribute__ ((__nothrow__ , __leaf__)) memset (void *__dest, int __ch, size_t __len)
-{
-  if (__builtin_constant_p (__len) && __len == 0
-      && (!__builtin_constant_p (__ch) || __ch != 0))
-    {
-      __warn_memset_zero_len ();
-      return __dest;
-    }
-  return __builtin___memset_chk (__dest, __ch, __len, __builtin_object_size (__dest, 0));
-}
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) void
-__attribute__ ((__nothrow__ , __leaf__)) bcopy (const void *__src, void *__dest, size_t __len)
-{
-  (void) __builtin___memmove_chk (__dest, __src, __len, __builtin_object_size (__dest, 0));
-}
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) void
-__attribute__ ((__nothrow__ , __leaf__)) bzero (void *__dest, size_t __len)
-{
-  (void) __builtin___memset_chk (__dest, '\0', __len, __builtin_object_size (__dest, 0));
-}
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) char *
-__attribute__ ((__nothrow__ , __leaf__)) strcpy (char *__restrict __dest, const char *__restrict __src)
-{
-  return __builtin___strcpy_chk (__dest, __src, __builtin_object_size (__dest, 2 > 1));
-}
-# 116 "/usr/include/x86_64-linux-gnu/bits/string3.h" 3 4
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) char *
-__attribute__ ((__nothrow__ , __leaf__)) strncpy (char *__restrict __dest, const char *__restrict __src, size_t __len)
-
-{
-  return __builtin___strncpy_chk (__dest, __src, __len, __builtin_object_size (__dest, 2 > 1));
-}
-
-
-extern char *__stpncpy_chk (char *__dest, const char *__src, size_t __n,
-       size_t __destlen) __attribute__ ((__nothrow__ , __leaf__));
-extern char *__stpncpy_alias (char *__dest, const char *__src, size_t __n) __asm__ ("" "stpncpy") __attribute__ ((__nothrow__ , __leaf__))
-                                 ;
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) char *
-__attribute__ ((__nothrow__ , __leaf__)) stpncpy (char *__dest, const char *__src, size_t __n)
-{
-  if (__builtin_object_size (__dest, 2 > 1) != (size_t) -1
-      && (!__builtin_constant_p (__n) || __n <= __builtin_object_size (__dest, 2 > 1)))
-    return __stpncpy_chk (__dest, __src, __n, __builtin_object_size (__dest, 2 > 1));
-  return __stpncpy_alias (__dest, __src, __n);
-}
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) char *
-__attribute__ ((__nothrow__ , __leaf__)) strcat (char *__restrict __dest, const char *__restrict __src)
-{
-  return __builtin___strcat_chk (__dest, __src, __builtin_object_size (__dest, 2 > 1));
-}
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) __attribute__ ((__artificial__)) char *
-__attribute__ ((__nothrow__ , __leaf__)) strncat (char *__restrict __dest, const char *__restrict __src, size_t __len)
-
-{
-  return __builtin___strncat_chk (__dest, __src, __len, __builtin_object_size (__dest, 2 > 1));
-}
-# 641 "/usr/include/string.h" 2 3 4
-
-
-
-
-# 4 "mpi_skeleton.c" 2
-# 1 "/usr/include/math.h" 1 3 4
-# 28 "/usr/include/math.h" 3 4
-
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/huge_val.h" 1 3 4
-# 33 "/usr/include/math.h" 2 3 4
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/huge_valf.h" 1 3 4
-# 35 "/usr/include/math.h" 2 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/huge_vall.h" 1 3 4
-# 36 "/usr/include/math.h" 2 3 4
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/inf.h" 1 3 4
-# 39 "/usr/include/math.h" 2 3 4
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/nan.h" 1 3 4
-# 42 "/usr/include/math.h" 2 3 4
-
-
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/mathdef.h" 1 3 4
-# 28 "/usr/include/x86_64-linux-gnu/bits/mathdef.h" 3 4
-typedef float float_t;
-typedef double double_t;
-# 46 "/usr/include/math.h" 2 3 4
-# 69 "/usr/include/math.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
-# 52 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-# 86 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-# 126 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-
-extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
-extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
-extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
-extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
-extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
-extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
-extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
-extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
-__extension__
-extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
-__extension__
-extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
-     __attribute__ ((__const__));
-
-
-extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
-     __attribute__ ((__const__));
-
-
-
-extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-# 371 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
-# 70 "/usr/include/math.h" 2 3 4
-# 88 "/usr/include/math.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
-# 52 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-# 86 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-# 126 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-
-extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
-extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
-extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
-extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
-extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
-extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
-extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
-extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-__extension__
-extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-__extension__
-extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
-     __attribute__ ((__const__));
-
-
-extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
-     __attribute__ ((__const__));
-
-
-
-extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-# 371 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
-# 89 "/usr/include/math.h" 2 3 4
-# 132 "/usr/include/math.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
-# 52 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-# 86 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
-
-# 126 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-
-
-extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-
-extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-
-extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-
-extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
-extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-
-extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-
-extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-
-extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-__extension__
-extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-__extension__
-extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
-
-
-extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
-
-
-
-extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
-     __attribute__ ((__const__));
-
-
-extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
-     __attribute__ ((__const__));
-
-
-
-extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-# 371 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
-extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
-# 133 "/usr/include/math.h" 2 3 4
-# 148 "/usr/include/math.h" 3 4
-extern int signgam;
-# 189 "/usr/include/math.h" 3 4
-enum
-  {
-    FP_NAN =
-
-      0,
-    FP_INFINITE =
-
-      1,
-    FP_ZERO =
-
-      2,
-    FP_SUBNORMAL =
-
-      3,
-    FP_NORMAL =
-
-      4
-  };
-# 301 "/usr/include/math.h" 3 4
-typedef enum
-{
-  _IEEE_ = -1,
-  _SVID_,
-  _XOPEN_,
-  _POSIX_,
-  _ISOC_
-} _LIB_VERSION_TYPE;
-
-
-
-
-extern _LIB_VERSION_TYPE _LIB_VERSION;
-# 326 "/usr/include/math.h" 3 4
-struct exception
-
-  {
-    int type;
-    char *name;
-    double arg1;
-    double arg2;
-    double retval;
-  };
-
-
-
-
-extern int matherr (struct exception *__exc);
-# 426 "/usr/include/math.h" 3 4
-# 1 "/usr/include/x86_64-linux-gnu/bits/mathinline.h" 1 3 4
-# 123 "/usr/include/x86_64-linux-gnu/bits/mathinline.h" 3 4
-
-
-
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) int
-__attribute__ ((__nothrow__ , __leaf__)) __signbitf (float __x)
-{
-
-  int __m;
-  __asm ("pmovmskb %1, %0" : "=r" (__m) : "x" (__x));
-  return (__m & 0x8) != 0;
-
-
-
-
-}
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) int
-__attribute__ ((__nothrow__ , __leaf__)) __signbit (double __x)
-{
-
-  int __m;
-  __asm ("pmovmskb %1, %0" : "=r" (__m) : "x" (__x));
-  return (__m & 0x80) != 0;
-
-
-
-
-}
-extern __inline __attribute__ ((__always_inline__)) __attribute__ ((__gnu_inline__)) int
-__attribute__ ((__nothrow__ , __leaf__)) __signbitl (long double __x)
-{
-  __extension__ union { long double __l; int __i[3]; } __u = { __l: __x };
-  return (__u.__i[2] & 0x8000) != 0;
-}
-
-
-# 427 "/usr/include/math.h" 2 3 4
-# 488 "/usr/include/math.h" 3 4
-
-# 5 "mpi_skeleton.c" 2
-# 1 "/usr/include/x86_64-linux-gnu/sys/time.h" 1 3 4
-# 25 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
-# 1 "/usr/include/time.h" 1 3 4
-# 26 "/usr/include/x86_64-linux-gnu/sys/time.h" 2 3 4
-
-# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
-# 28 "/usr/include/x86_64-linux-gnu/sys/time.h" 2 3 4
-# 37 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
-
-# 55 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
-struct timezone
-  {
-    int tz_minuteswest;
-    int tz_dsttime;
-  };
-
-typedef struct timezone *__restrict __timezone_ptr_t;
-# 71 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
-extern int gettimeofday (struct timeval *__restrict __tv,
-    __timezone_ptr_t __tz) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-
-extern int settimeofday (const struct timeval *__tv,
-    const struct timezone *__tz)
-     __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-
-extern int adjtime (const struct timeval *__delta,
-      struct timeval *__olddelta) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-enum __itimer_which
-  {
-
-    ITIMER_REAL = 0,
-
-
-    ITIMER_VIRTUAL = 1,
-
-
-
-    ITIMER_PROF = 2
-
-  };
-
-
-
-struct itimerval
-  {
-
-    struct timeval it_interval;
-
-    struct timeval it_value;
-  };
-
-
-
-
-
-
-typedef int __itimer_which_t;
-
-
-
-
-extern int getitimer (__itimer_which_t __which,
-        struct itimerval *__value) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int setitimer (__itimer_which_t __which,
-        const struct itimerval *__restrict __new,
-        struct itimerval *__restrict __old) __attribute__ ((__nothrow__ , __leaf__));
-
-
-
-
-extern int utimes (const char *__file, const struct timeval __tvp[2])
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-
-extern int lutimes (const char *__file, const struct timeval __tvp[2])
-     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
-
-
-extern int futimes (int __fd, const struct timeval __tvp[2]) __attribute__ ((__nothrow__ , __leaf__));
-# 189 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
-
-# 6 "mpi_skeleton.c" 2
-# 1 "/usr/include/mpi/mpi.h" 1 3 4
-# 220 "/usr/include/mpi/mpi.h" 3 4
-# 1 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 1 3 4
-# 147 "/usr/lib/gcc/x86_64-linux-gnu/4.8/include/stddef.h" 3 4
-typedef long int ptrdiff_t;
-# 221 "/usr/include/mpi/mpi.h" 2 3 4
-# 253 "/usr/include/mpi/mpi.h" 3 4
-# 1 "/usr/include/mpi/mpi_portable_platform.h" 1 3 4
-# 254 "/usr/include/mpi/mpi.h" 2 3 4
-# 317 "/usr/include/mpi/mpi.h" 3 4
-typedef ptrdiff_t MPI_Aint;
-typedef long long MPI_Offset;
-typedef struct ompi_communicator_t *MPI_Comm;
-typedef struct ompi_datatype_t *MPI_Datatype;
-typedef struct ompi_errhandler_t *MPI_Errhandler;
-
-typedef struct ompi_file_t *MPI_File;
-
-typedef struct ompi_group_t *MPI_Group;
-typedef struct ompi_info_t *MPI_Info;
-typedef struct ompi_op_t *MPI_Op;
-typedef struct ompi_request_t *MPI_Request;
-typedef struct ompi_status_public_t MPI_Status;
-typedef struct ompi_win_t *MPI_Win;
-
-
-
-
-struct ompi_status_public_t {
-
-
-    int MPI_SOURCE;
-    int MPI_TAG;
-    int MPI_ERROR;
-
-
-
-
-    int _cancelled;
-    size_t _ucount;
-};
-typedef struct ompi_status_public_t ompi_status_public_t;
-# 358 "/usr/include/mpi/mpi.h" 3 4
-typedef int (MPI_Copy_function)(MPI_Comm, int, void *,
-                                void *, void *, int *);
-typedef int (MPI_Delete_function)(MPI_Comm, int, void *, void *);
-typedef int (MPI_Datarep_extent_function)(MPI_Datatype, MPI_Aint *, void *);
-typedef int (MPI_Datarep_conversion_function)(void *, MPI_Datatype,
-                                              int, void *, MPI_Offset, void *);
-typedef void (MPI_Comm_errhandler_function)(MPI_Comm *, int *, ...);
-typedef MPI_Comm_errhandler_function MPI_Comm_errhandler_fn
-        ;
-
-
-
-
-
-
-typedef void (ompi_file_errhandler_fn)(MPI_File *, int *, ...);
-typedef ompi_file_errhandler_fn MPI_File_errhandler_fn
-        ;
-typedef ompi_file_errhandler_fn MPI_File_errhandler_function;
-
-
-
-
-typedef void (MPI_Win_errhandler_function)(MPI_Win *, int *, ...);
-typedef MPI_Win_errhandler_function MPI_Win_errhandler_fn
-        ;
-
-
-
-typedef void (MPI_Handler_function)(MPI_Comm *, int *, ...);
-typedef void (MPI_User_function)(void *, void *, int *, MPI_Datatype *);
-typedef int (MPI_Comm_copy_attr_function)(MPI_Comm, int, void *,
-                                            void *, void *, int *);
-typedef int (MPI_Comm_delete_attr_function)(MPI_Comm, int, void *, void *);
-typedef int (MPI_Type_copy_attr_function)(MPI_Datatype, int, void *,
-                                            void *, void *, int *);
-typedef int (MPI_Type_delete_attr_function)(MPI_Datatype, int,
-                                              void *, void *);
-typedef int (MPI_Win_copy_attr_function)(MPI_Win, int, void *,
-                                           void *, void *, int *);
-typedef int (MPI_Win_delete_attr_function)(MPI_Win, int, void *, void *);
-typedef int (MPI_Grequest_query_function)(void *, MPI_Status *);
-typedef int (MPI_Grequest_free_function)(void *);
-typedef int (MPI_Grequest_cancel_function)(void *, int);
-# 484 "/usr/include/mpi/mpi.h" 3 4
-enum {
-
-    MPI_TAG_UB,
-    MPI_HOST,
-    MPI_IO,
-    MPI_WTIME_IS_GLOBAL,
-
-
-    MPI_APPNUM,
-    MPI_LASTUSEDCODE,
-    MPI_UNIVERSE_SIZE,
-    MPI_WIN_BASE,
-    MPI_WIN_SIZE,
-    MPI_WIN_DISP_UNIT,
-
-
-
-    IMPI_CLIENT_SIZE,
-    IMPI_CLIENT_COLOR,
-    IMPI_HOST_SIZE,
-    IMPI_HOST_COLOR
-};
-# 575 "/usr/include/mpi/mpi.h" 3 4
-enum {
-  MPI_IDENT,
-  MPI_CONGRUENT,
-  MPI_SIMILAR,
-  MPI_UNEQUAL
-};
-
-
-
-
-
-enum {
-  MPI_THREAD_SINGLE,
-  MPI_THREAD_FUNNELED,
-  MPI_THREAD_SERIALIZED,
-  MPI_THREAD_MULTIPLE
-};
-
-
-
-
-
-enum {
-  MPI_COMBINER_NAMED,
-  MPI_COMBINER_DUP,
-  MPI_COMBINER_CONTIGUOUS,
-  MPI_COMBINER_VECTOR,
-  MPI_COMBINER_HVECTOR_INTEGER,
-  MPI_COMBINER_HVECTOR,
-  MPI_COMBINER_INDEXED,
-  MPI_COMBINER_HINDEXED_INTEGER,
-  MPI_COMBINER_HINDEXED,
-  MPI_COMBINER_INDEXED_BLOCK,
-  MPI_COMBINER_STRUCT_INTEGER,
-  MPI_COMBINER_STRUCT,
-  MPI_COMBINER_SUBARRAY,
-  MPI_COMBINER_DARRAY,
-  MPI_COMBINER_F90_REAL,
-  MPI_COMBINER_F90_COMPLEX,
-  MPI_COMBINER_F90_INTEGER,
-  MPI_COMBINER_RESIZED
-};
-# 678 "/usr/include/mpi/mpi.h" 3 4
-__attribute__((visibility("default"))) int OMPI_C_MPI_TYPE_NULL_DELETE_FN( MPI_Datatype datatype,
-                                                  int type_keyval,
-                                                  void* attribute_val_out,
-                                                  void* extra_state );
-__attribute__((visibility("default"))) int OMPI_C_MPI_TYPE_NULL_COPY_FN( MPI_Datatype datatype,
-                                                int type_keyval,
-                                                void* extra_state,
-                                                void* attribute_val_in,
-                                                void* attribute_val_out,
-                                                int* flag );
-__attribute__((visibility("default"))) int OMPI_C_MPI_TYPE_DUP_FN( MPI_Datatype datatype,
-                                          int type_keyval,
-                                          void* extra_state,
-                                          void* attribute_val_in,
-                                          void* attribute_val_out,
-                                          int* flag );
-__attribute__((visibility("default"))) int OMPI_C_MPI_COMM_NULL_DELETE_FN( MPI_Comm comm,
-                                                  int comm_keyval,
-                                                  void* attribute_val_out,
-                                                  void* extra_state );
-__attribute__((visibility("default"))) int OMPI_C_MPI_COMM_NULL_COPY_FN( MPI_Comm comm,
-                                                int comm_keyval,
-                                                void* extra_state,
-                                                void* attribute_val_in,
-                                                void* attribute_val_out,
-                                                int* flag );
-__attribute__((visibility("default"))) int OMPI_C_MPI_COMM_DUP_FN( MPI_Comm comm, int comm_keyval,
-                                          void* extra_state,
-                                          void* attribute_val_in,
-                                          void* attribute_val_out,
-                                          int* flag );
-__attribute__((visibility("default"))) int OMPI_C_MPI_NULL_DELETE_FN( MPI_Comm comm, int comm_keyval,
-                                             void* attribute_val_out,
-                                             void* extra_state )
-                                             ;
-__attribute__((visibility("default"))) int OMPI_C_MPI_NULL_COPY_FN( MPI_Comm comm, int comm_keyval,
-                                           void* extra_state,
-                                           void* attribute_val_in,
-                                           void* attribute_val_out,
-                                           int* flag )
-                                           ;
-__attribute__((visibility("default"))) int OMPI_C_MPI_DUP_FN( MPI_Comm comm, int comm_keyval,
-                                     void* extra_state,
-                                     void* attribute_val_in,
-                                     void* attribute_val_out,
-                                     int* flag )
-                                     ;
-__attribute__((visibility("default"))) int OMPI_C_MPI_WIN_NULL_DELETE_FN( MPI_Win window,
-                                                 int win_keyval,
-                                                 void* attribute_val_out,
-                                                 void* extra_state );
-__attribute__((visibility("default"))) int OMPI_C_MPI_WIN_NULL_COPY_FN( MPI_Win window, int win_keyval,
-                                               void* extra_state,
-                                               void* attribute_val_in,
-                                               void* attribute_val_out,
-                                               int* flag );
-__attribute__((visibility("default"))) int OMPI_C_MPI_WIN_DUP_FN( MPI_Win window, int win_keyval,
-                                         void* extra_state,
-                                         void* attribute_val_in,
-                                         void* attribute_val_out,
-                                         int* flag );
-# 748 "/usr/include/mpi/mpi.h" 3 4
-__attribute__((visibility("default"))) extern struct ompi_predefined_communicator_t ompi_mpi_comm_world;
-__attribute__((visibility("default"))) extern struct ompi_predefined_communicator_t ompi_mpi_comm_self;
-__attribute__((visibility("default"))) extern struct ompi_predefined_communicator_t ompi_mpi_comm_null;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_group_t ompi_mpi_group_empty;
-__attribute__((visibility("default"))) extern struct ompi_predefined_group_t ompi_mpi_group_null;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_request_t ompi_request_null;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_null;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_min;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_max;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_sum;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_prod;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_land;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_band;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_lor;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_bor;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_lxor;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_bxor;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_maxloc;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_minloc;
-__attribute__((visibility("default"))) extern struct ompi_predefined_op_t ompi_mpi_op_replace;
-
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_datatype_null;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_lb ;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_ub ;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_char;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_signed_char;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_unsigned_char;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_byte;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_short;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_unsigned_short;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_unsigned;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_long;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_unsigned_long;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_long_long_int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_unsigned_long_long;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_float;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_double;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_long_double;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_wchar;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_packed;
-
-
-
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_cxx_bool;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_cxx_cplex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_cxx_dblcplex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_cxx_ldblcplex;
-
-
-
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_logical;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_character;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_integer;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_real;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_dblprec;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_cplex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_dblcplex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_ldblcplex;
-
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_2int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_2integer;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_2real;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_2dblprec;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_2cplex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_2dblcplex;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_float_int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_double_int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_longdbl_int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_short_int;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_long_int;
-
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_logical1;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_logical2;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_logical4;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_logical8;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_integer1;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_integer2;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_integer4;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_integer8;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_integer16;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_real2;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_real4;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_real8;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_real16;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_complex8;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_complex16;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_complex32;
-
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_int8_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_uint8_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_int16_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_uint16_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_int32_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_uint32_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_int64_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_uint64_t;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_aint;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_offset;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_c_bool;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_c_complex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_c_float_complex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_c_double_complex;
-__attribute__((visibility("default"))) extern struct ompi_predefined_datatype_t ompi_mpi_c_long_double_complex;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_errhandler_t ompi_mpi_errhandler_null;
-__attribute__((visibility("default"))) extern struct ompi_predefined_errhandler_t ompi_mpi_errors_are_fatal;
-__attribute__((visibility("default"))) extern struct ompi_predefined_errhandler_t ompi_mpi_errors_return;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_win_t ompi_mpi_win_null;
-__attribute__((visibility("default"))) extern struct ompi_predefined_file_t ompi_mpi_file_null;
-
-__attribute__((visibility("default"))) extern struct ompi_predefined_info_t ompi_mpi_info_null;
-
-__attribute__((visibility("default"))) extern int *MPI_F_STATUS_IGNORE;
-__attribute__((visibility("default"))) extern int *MPI_F_STATUSES_IGNORE;
-# 1024 "/usr/include/mpi/mpi.h" 3 4
-__attribute__((visibility("default"))) int MPI_Abort(MPI_Comm comm, int errorcode);
-__attribute__((visibility("default"))) int MPI_Accumulate(void *origin_addr, int origin_count, MPI_Datatype origin_datatype,
-                                  int target_rank, MPI_Aint target_disp, int target_count,
-                                  MPI_Datatype target_datatype, MPI_Op op, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Add_error_class(int *errorclass);
-__attribute__((visibility("default"))) int MPI_Add_error_code(int errorclass, int *errorcode);
-__attribute__((visibility("default"))) int MPI_Add_error_string(int errorcode, char *string);
-__attribute__((visibility("default"))) int MPI_Address(void *location, MPI_Aint *address)
-                               ;
-__attribute__((visibility("default"))) int MPI_Allgather(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                 void *recvbuf, int recvcount,
-                                 MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Allgatherv(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                  void *recvbuf, int *recvcounts,
-                                  int *displs, MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Alloc_mem(MPI_Aint size, MPI_Info info,
-                                 void *baseptr);
-__attribute__((visibility("default"))) int MPI_Allreduce(void *sendbuf, void *recvbuf, int count,
-                                 MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Alltoall(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                void *recvbuf, int recvcount,
-                                MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Alltoallv(void *sendbuf, int *sendcounts, int *sdispls,
-                                 MPI_Datatype sendtype, void *recvbuf, int *recvcounts,
-                                 int *rdispls, MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Alltoallw(void *sendbuf, int *sendcounts, int *sdispls, MPI_Datatype *sendtypes,
-                                 void *recvbuf, int *recvcounts, int *rdispls, MPI_Datatype *recvtypes,
-                                 MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Attr_delete(MPI_Comm comm, int keyval)
-                                   ;
-__attribute__((visibility("default"))) int MPI_Attr_get(MPI_Comm comm, int keyval, void *attribute_val, int *flag)
-                                ;
-__attribute__((visibility("default"))) int MPI_Attr_put(MPI_Comm comm, int keyval, void *attribute_val)
-                                ;
-__attribute__((visibility("default"))) int MPI_Barrier(MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype,
-                             int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Bsend(void *buf, int count, MPI_Datatype datatype,
-                             int dest, int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Bsend_init(void *buf, int count, MPI_Datatype datatype,
-                                  int dest, int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Buffer_attach(void *buffer, int size);
-__attribute__((visibility("default"))) int MPI_Buffer_detach(void *buffer, int *size);
-__attribute__((visibility("default"))) int MPI_Cancel(MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int *coords);
-__attribute__((visibility("default"))) int MPI_Cart_create(MPI_Comm old_comm, int ndims, int *dims,
-                                   int *periods, int reorder, MPI_Comm *comm_cart);
-__attribute__((visibility("default"))) int MPI_Cart_get(MPI_Comm comm, int maxdims, int *dims,
-                                int *periods, int *coords);
-__attribute__((visibility("default"))) int MPI_Cart_map(MPI_Comm comm, int ndims, int *dims,
-                                int *periods, int *newrank);
-__attribute__((visibility("default"))) int MPI_Cart_rank(MPI_Comm comm, int *coords, int *rank);
-__attribute__((visibility("default"))) int MPI_Cart_shift(MPI_Comm comm, int direction, int disp,
-                                  int *rank_source, int *rank_dest);
-__attribute__((visibility("default"))) int MPI_Cart_sub(MPI_Comm comm, int *remain_dims, MPI_Comm *new_comm);
-__attribute__((visibility("default"))) int MPI_Cartdim_get(MPI_Comm comm, int *ndims);
-__attribute__((visibility("default"))) int MPI_Close_port(char *port_name);
-__attribute__((visibility("default"))) int MPI_Comm_accept(char *port_name, MPI_Info info, int root,
-                                   MPI_Comm comm, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int MPI_Comm_c2f(MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Comm_call_errhandler(MPI_Comm comm, int errorcode);
-__attribute__((visibility("default"))) int MPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int *result);
-__attribute__((visibility("default"))) int MPI_Comm_connect(char *port_name, MPI_Info info, int root,
-                                    MPI_Comm comm, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int MPI_Comm_create_errhandler(MPI_Comm_errhandler_function *function,
-                                              MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn,
-                                          MPI_Comm_delete_attr_function *comm_delete_attr_fn,
-                                          int *comm_keyval, void *extra_state);
-__attribute__((visibility("default"))) int MPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int MPI_Comm_delete_attr(MPI_Comm comm, int comm_keyval);
-__attribute__((visibility("default"))) int MPI_Comm_disconnect(MPI_Comm *comm);
-__attribute__((visibility("default"))) int MPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) MPI_Comm MPI_Comm_f2c(int comm);
-__attribute__((visibility("default"))) int MPI_Comm_free_keyval(int *comm_keyval);
-__attribute__((visibility("default"))) int MPI_Comm_free(MPI_Comm *comm);
-__attribute__((visibility("default"))) int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval,
-                                     void *attribute_val, int *flag);
-__attribute__((visibility("default"))) int MPI_Comm_get_errhandler(MPI_Comm comm, MPI_Errhandler *erhandler);
-__attribute__((visibility("default"))) int MPI_Comm_get_name(MPI_Comm comm, char *comm_name, int *resultlen);
-__attribute__((visibility("default"))) int MPI_Comm_get_parent(MPI_Comm *parent);
-__attribute__((visibility("default"))) int MPI_Comm_group(MPI_Comm comm, MPI_Group *group);
-__attribute__((visibility("default"))) int MPI_Comm_join(int fd, MPI_Comm *intercomm);
-__attribute__((visibility("default"))) int MPI_Comm_rank(MPI_Comm comm, int *rank);
-__attribute__((visibility("default"))) int MPI_Comm_remote_group(MPI_Comm comm, MPI_Group *group);
-__attribute__((visibility("default"))) int MPI_Comm_remote_size(MPI_Comm comm, int *size);
-__attribute__((visibility("default"))) int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);
-__attribute__((visibility("default"))) int MPI_Comm_set_errhandler(MPI_Comm comm, MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int MPI_Comm_set_name(MPI_Comm comm, char *comm_name);
-__attribute__((visibility("default"))) int MPI_Comm_size(MPI_Comm comm, int *size);
-__attribute__((visibility("default"))) int MPI_Comm_spawn(char *command, char **argv, int maxprocs, MPI_Info info,
-                                  int root, MPI_Comm comm, MPI_Comm *intercomm,
-                                  int *array_of_errcodes);
-__attribute__((visibility("default"))) int MPI_Comm_spawn_multiple(int count, char **array_of_commands, char ***array_of_argv,
-                                           int *array_of_maxprocs, MPI_Info *array_of_info,
-                                           int root, MPI_Comm comm, MPI_Comm *intercomm,
-                                           int *array_of_errcodes);
-__attribute__((visibility("default"))) int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int MPI_Comm_test_inter(MPI_Comm comm, int *flag);
-__attribute__((visibility("default"))) int MPI_Dims_create(int nnodes, int ndims, int *dims);
-__attribute__((visibility("default"))) int MPI_Errhandler_c2f(MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int MPI_Errhandler_create(MPI_Handler_function *function,
-                                         MPI_Errhandler *errhandler)
-                                         ;
-__attribute__((visibility("default"))) MPI_Errhandler MPI_Errhandler_f2c(int errhandler);
-__attribute__((visibility("default"))) int MPI_Errhandler_free(MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int MPI_Errhandler_get(MPI_Comm comm, MPI_Errhandler *errhandler)
-                                      ;
-__attribute__((visibility("default"))) int MPI_Errhandler_set(MPI_Comm comm, MPI_Errhandler errhandler)
-                                      ;
-__attribute__((visibility("default"))) int MPI_Error_class(int errorcode, int *errorclass);
-__attribute__((visibility("default"))) int MPI_Error_string(int errorcode, char *string, int *resultlen);
-__attribute__((visibility("default"))) int MPI_Exscan(void *sendbuf, void *recvbuf, int count,
-                              MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-
-__attribute__((visibility("default"))) int MPI_File_c2f(MPI_File file);
-__attribute__((visibility("default"))) MPI_File MPI_File_f2c(int file);
-__attribute__((visibility("default"))) int MPI_File_call_errhandler(MPI_File fh, int errorcode);
-__attribute__((visibility("default"))) int MPI_File_create_errhandler(MPI_File_errhandler_function *function,
-                                              MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int MPI_File_set_errhandler( MPI_File file, MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int MPI_File_get_errhandler( MPI_File file, MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int MPI_File_open(MPI_Comm comm, char *filename, int amode,
-                                 MPI_Info info, MPI_File *fh);
-__attribute__((visibility("default"))) int MPI_File_close(MPI_File *fh);
-__attribute__((visibility("default"))) int MPI_File_delete(char *filename, MPI_Info info);
-__attribute__((visibility("default"))) int MPI_File_set_size(MPI_File fh, MPI_Offset size);
-__attribute__((visibility("default"))) int MPI_File_preallocate(MPI_File fh, MPI_Offset size);
-__attribute__((visibility("default"))) int MPI_File_get_size(MPI_File fh, MPI_Offset *size);
-__attribute__((visibility("default"))) int MPI_File_get_group(MPI_File fh, MPI_Group *group);
-__attribute__((visibility("default"))) int MPI_File_get_amode(MPI_File fh, int *amode);
-__attribute__((visibility("default"))) int MPI_File_set_info(MPI_File fh, MPI_Info info);
-__attribute__((visibility("default"))) int MPI_File_get_info(MPI_File fh, MPI_Info *info_used);
-__attribute__((visibility("default"))) int MPI_File_set_view(MPI_File fh, MPI_Offset disp, MPI_Datatype etype,
-                                     MPI_Datatype filetype, char *datarep, MPI_Info info);
-__attribute__((visibility("default"))) int MPI_File_get_view(MPI_File fh, MPI_Offset *disp,
-                                     MPI_Datatype *etype,
-                                     MPI_Datatype *filetype, char *datarep);
-__attribute__((visibility("default"))) int MPI_File_read_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                    int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_read_at_all(MPI_File fh, MPI_Offset offset, void *buf,
-                                        int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                     int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_at_all(MPI_File fh, MPI_Offset offset, void *buf,
-                                         int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_iread_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                     int count, MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_File_iwrite_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                      int count, MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_File_read(MPI_File fh, void *buf, int count,
-                                 MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_read_all(MPI_File fh, void *buf, int count,
-                                     MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write(MPI_File fh, void *buf, int count,
-                                  MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_all(MPI_File fh, void *buf, int count,
-                                      MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_iread(MPI_File fh, void *buf, int count,
-                                  MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_File_iwrite(MPI_File fh, void *buf, int count,
-                                   MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_File_seek(MPI_File fh, MPI_Offset offset, int whence);
-__attribute__((visibility("default"))) int MPI_File_get_position(MPI_File fh, MPI_Offset *offset);
-__attribute__((visibility("default"))) int MPI_File_get_byte_offset(MPI_File fh, MPI_Offset offset,
-                                            MPI_Offset *disp);
-__attribute__((visibility("default"))) int MPI_File_read_shared(MPI_File fh, void *buf, int count,
-                                        MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_shared(MPI_File fh, void *buf, int count,
-      MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_iread_shared(MPI_File fh, void *buf, int count,
-                                         MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_File_iwrite_shared(MPI_File fh, void *buf, int count,
-                                          MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_File_read_ordered(MPI_File fh, void *buf, int count,
-                                         MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_ordered(MPI_File fh, void *buf, int count,
-                                          MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_seek_shared(MPI_File fh, MPI_Offset offset, int whence);
-__attribute__((visibility("default"))) int MPI_File_get_position_shared(MPI_File fh, MPI_Offset *offset);
-__attribute__((visibility("default"))) int MPI_File_read_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf,
-                                              int count, MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_File_read_at_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf,
-                                               int count, MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_File_write_at_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_read_all_begin(MPI_File fh, void *buf, int count,
-                                           MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_File_read_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_all_begin(MPI_File fh, void *buf, int count,
-                                            MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_File_write_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_read_ordered_begin(MPI_File fh, void *buf, int count,
-                                               MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_File_read_ordered_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_write_ordered_begin(MPI_File fh, void *buf, int count,
-                                                MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_File_write_ordered_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_File_get_type_extent(MPI_File fh, MPI_Datatype datatype,
-                                            MPI_Aint *extent);
-__attribute__((visibility("default"))) int MPI_File_set_atomicity(MPI_File fh, int flag);
-__attribute__((visibility("default"))) int MPI_File_get_atomicity(MPI_File fh, int *flag);
-__attribute__((visibility("default"))) int MPI_File_sync(MPI_File fh);
-
-__attribute__((visibility("default"))) int MPI_Finalize(void);
-__attribute__((visibility("default"))) int MPI_Finalized(int *flag);
-__attribute__((visibility("default"))) int MPI_Free_mem(void *base);
-__attribute__((visibility("default"))) int MPI_Gather(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                              void *recvbuf, int recvcount, MPI_Datatype recvtype,
-                              int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Gatherv(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                               void *recvbuf, int *recvcounts, int *displs,
-                               MPI_Datatype recvtype, int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Get_address(void *location, MPI_Aint *address);
-__attribute__((visibility("default"))) int MPI_Get_count(MPI_Status *status, MPI_Datatype datatype, int *count);
-__attribute__((visibility("default"))) int MPI_Get_elements(MPI_Status *status, MPI_Datatype datatype, int *count);
-__attribute__((visibility("default"))) int MPI_Get(void *origin_addr, int origin_count,
-                           MPI_Datatype origin_datatype, int target_rank,
-                           MPI_Aint target_disp, int target_count,
-                           MPI_Datatype target_datatype, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Get_processor_name(char *name, int *resultlen);
-__attribute__((visibility("default"))) int MPI_Get_version(int *version, int *subversion);
-__attribute__((visibility("default"))) int MPI_Graph_create(MPI_Comm comm_old, int nnodes, int *index,
-                                    int *edges, int reorder, MPI_Comm *comm_graph);
-__attribute__((visibility("default"))) int MPI_Graph_get(MPI_Comm comm, int maxindex, int maxedges,
-                                 int *index, int *edges);
-__attribute__((visibility("default"))) int MPI_Graph_map(MPI_Comm comm, int nnodes, int *index, int *edges,
-                                 int *newrank);
-__attribute__((visibility("default"))) int MPI_Graph_neighbors_count(MPI_Comm comm, int rank, int *nneighbors);
-__attribute__((visibility("default"))) int MPI_Graph_neighbors(MPI_Comm comm, int rank, int maxneighbors,
-                                       int *neighbors);
-__attribute__((visibility("default"))) int MPI_Graphdims_get(MPI_Comm comm, int *nnodes, int *nedges);
-__attribute__((visibility("default"))) int MPI_Grequest_complete(MPI_Request request);
-__attribute__((visibility("default"))) int MPI_Grequest_start(MPI_Grequest_query_function *query_fn,
-                                      MPI_Grequest_free_function *free_fn,
-                                      MPI_Grequest_cancel_function *cancel_fn,
-                                      void *extra_state, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Group_c2f(MPI_Group group);
-__attribute__((visibility("default"))) int MPI_Group_compare(MPI_Group group1, MPI_Group group2, int *result);
-__attribute__((visibility("default"))) int MPI_Group_difference(MPI_Group group1, MPI_Group group2,
-                                        MPI_Group *newgroup);
-__attribute__((visibility("default"))) int MPI_Group_excl(MPI_Group group, int n, int *ranks,
-                                  MPI_Group *newgroup);
-__attribute__((visibility("default"))) MPI_Group MPI_Group_f2c(int group);
-__attribute__((visibility("default"))) int MPI_Group_free(MPI_Group *group);
-__attribute__((visibility("default"))) int MPI_Group_incl(MPI_Group group, int n, int *ranks,
-                                  MPI_Group *newgroup);
-__attribute__((visibility("default"))) int MPI_Group_intersection(MPI_Group group1, MPI_Group group2,
-                                          MPI_Group *newgroup);
-__attribute__((visibility("default"))) int MPI_Group_range_excl(MPI_Group group, int n, int ranges[][3],
-                                        MPI_Group *newgroup);
-__attribute__((visibility("default"))) int MPI_Group_range_incl(MPI_Group group, int n, int ranges[][3],
-                                        MPI_Group *newgroup);
-__attribute__((visibility("default"))) int MPI_Group_rank(MPI_Group group, int *rank);
-__attribute__((visibility("default"))) int MPI_Group_size(MPI_Group group, int *size);
-__attribute__((visibility("default"))) int MPI_Group_translate_ranks(MPI_Group group1, int n, int *ranks1,
-                                             MPI_Group group2, int *ranks2);
-__attribute__((visibility("default"))) int MPI_Group_union(MPI_Group group1, MPI_Group group2,
-                                   MPI_Group *newgroup);
-__attribute__((visibility("default"))) int MPI_Ibsend(void *buf, int count, MPI_Datatype datatype, int dest,
-                              int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Info_c2f(MPI_Info info);
-__attribute__((visibility("default"))) int MPI_Info_create(MPI_Info *info);
-__attribute__((visibility("default"))) int MPI_Info_delete(MPI_Info info, char *key);
-__attribute__((visibility("default"))) int MPI_Info_dup(MPI_Info info, MPI_Info *newinfo);
-__attribute__((visibility("default"))) MPI_Info MPI_Info_f2c(int info);
-__attribute__((visibility("default"))) int MPI_Info_free(MPI_Info *info);
-__attribute__((visibility("default"))) int MPI_Info_get(MPI_Info info, char *key, int valuelen,
-                                char *value, int *flag);
-__attribute__((visibility("default"))) int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);
-__attribute__((visibility("default"))) int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);
-__attribute__((visibility("default"))) int MPI_Info_get_valuelen(MPI_Info info, char *key, int *valuelen,
-                                         int *flag);
-__attribute__((visibility("default"))) int MPI_Info_set(MPI_Info info, char *key, char *value);
-__attribute__((visibility("default"))) int MPI_Init(int *argc, char ***argv);
-__attribute__((visibility("default"))) int MPI_Initialized(int *flag);
-__attribute__((visibility("default"))) int MPI_Init_thread(int *argc, char ***argv, int required,
-                                   int *provided);
-__attribute__((visibility("default"))) int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader,
-                                        MPI_Comm bridge_comm, int remote_leader,
-                                        int tag, MPI_Comm *newintercomm);
-__attribute__((visibility("default"))) int MPI_Intercomm_merge(MPI_Comm intercomm, int high,
-                                       MPI_Comm *newintercomm);
-__attribute__((visibility("default"))) int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag,
-                              MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source,
-                             int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Irsend(void *buf, int count, MPI_Datatype datatype, int dest,
-                              int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Isend(void *buf, int count, MPI_Datatype datatype, int dest,
-                             int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Issend(void *buf, int count, MPI_Datatype datatype, int dest,
-                              int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Is_thread_main(int *flag);
-__attribute__((visibility("default"))) int MPI_Keyval_create(MPI_Copy_function *copy_fn,
-                                     MPI_Delete_function *delete_fn,
-                                     int *keyval, void *extra_state)
-                                     ;
-__attribute__((visibility("default"))) int MPI_Keyval_free(int *keyval)
-                                   ;
-__attribute__((visibility("default"))) int MPI_Lookup_name(char *service_name, MPI_Info info, char *port_name);
-__attribute__((visibility("default"))) int MPI_Op_c2f(MPI_Op op);
-__attribute__((visibility("default"))) int MPI_Op_commutative(MPI_Op op, int *commute);
-__attribute__((visibility("default"))) int MPI_Op_create(MPI_User_function *function, int commute, MPI_Op *op);
-__attribute__((visibility("default"))) int MPI_Open_port(MPI_Info info, char *port_name);
-__attribute__((visibility("default"))) MPI_Op MPI_Op_f2c(int op);
-__attribute__((visibility("default"))) int MPI_Op_free(MPI_Op *op);
-__attribute__((visibility("default"))) int MPI_Pack_external(char *datarep, void *inbuf, int incount,
-                                     MPI_Datatype datatype, void *outbuf,
-                                     MPI_Aint outsize, MPI_Aint *position);
-__attribute__((visibility("default"))) int MPI_Pack_external_size(char *datarep, int incount,
-                                          MPI_Datatype datatype, MPI_Aint *size);
-__attribute__((visibility("default"))) int MPI_Pack(void *inbuf, int incount, MPI_Datatype datatype,
-                            void *outbuf, int outsize, int *position, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Pack_size(int incount, MPI_Datatype datatype, MPI_Comm comm,
-                                 int *size);
-__attribute__((visibility("default"))) int MPI_Pcontrol(const int level, ...);
-__attribute__((visibility("default"))) int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Publish_name(char *service_name, MPI_Info info,
-                                    char *port_name);
-__attribute__((visibility("default"))) int MPI_Put(void *origin_addr, int origin_count, MPI_Datatype origin_datatype,
-                           int target_rank, MPI_Aint target_disp, int target_count,
-                           MPI_Datatype target_datatype, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Query_thread(int *provided);
-__attribute__((visibility("default"))) int MPI_Recv_init(void *buf, int count, MPI_Datatype datatype, int source,
-                                 int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source,
-                            int tag, MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Reduce(void *sendbuf, void *recvbuf, int count,
-                              MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Reduce_local(void *inbuf, void *inoutbuf, int count,
-                                    MPI_Datatype datatype, MPI_Op op);
-__attribute__((visibility("default"))) int MPI_Reduce_scatter(void *sendbuf, void *recvbuf, int *recvcounts,
-                                      MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Register_datarep(char *datarep,
-                                        MPI_Datarep_conversion_function *read_conversion_fn,
-                                        MPI_Datarep_conversion_function *write_conversion_fn,
-                                        MPI_Datarep_extent_function *dtype_file_extent_fn,
-                                        void *extra_state);
-__attribute__((visibility("default"))) int MPI_Request_c2f(MPI_Request request);
-__attribute__((visibility("default"))) MPI_Request MPI_Request_f2c(int request);
-__attribute__((visibility("default"))) int MPI_Request_free(MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Request_get_status(MPI_Request request, int *flag,
-                                          MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Rsend(void *ibuf, int count, MPI_Datatype datatype, int dest,
-                             int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Rsend_init(void *buf, int count, MPI_Datatype datatype,
-                                  int dest, int tag, MPI_Comm comm,
-                                  MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Scan(void *sendbuf, void *recvbuf, int count,
-                            MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Scatter(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                               void *recvbuf, int recvcount, MPI_Datatype recvtype,
-                               int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Scatterv(void *sendbuf, int *sendcounts, int *displs,
-                                MPI_Datatype sendtype, void *recvbuf, int recvcount,
-                                MPI_Datatype recvtype, int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Send_init(void *buf, int count, MPI_Datatype datatype,
-                                 int dest, int tag, MPI_Comm comm,
-                                 MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Send(void *buf, int count, MPI_Datatype datatype, int dest,
-                            int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Sendrecv(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                int dest, int sendtag, void *recvbuf, int recvcount,
-                                MPI_Datatype recvtype, int source, int recvtag,
-                                MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Sendrecv_replace(void * buf, int count, MPI_Datatype datatype,
-                                        int dest, int sendtag, int source, int recvtag,
-                                        MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Ssend_init(void *buf, int count, MPI_Datatype datatype,
-                                  int dest, int tag, MPI_Comm comm,
-                                  MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Ssend(void *buf, int count, MPI_Datatype datatype, int dest,
-                             int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Start(MPI_Request *request);
-__attribute__((visibility("default"))) int MPI_Startall(int count, MPI_Request *array_of_requests);
-__attribute__((visibility("default"))) int MPI_Status_c2f(MPI_Status *c_status, int *f_status);
-__attribute__((visibility("default"))) int MPI_Status_f2c(int *f_status, MPI_Status *c_status);
-__attribute__((visibility("default"))) int MPI_Status_set_cancelled(MPI_Status *status, int flag);
-__attribute__((visibility("default"))) int MPI_Status_set_elements(MPI_Status *status, MPI_Datatype datatype,
-                                           int count);
-__attribute__((visibility("default"))) int MPI_Testall(int count, MPI_Request array_of_requests[], int *flag,
-                               MPI_Status array_of_statuses[]);
-__attribute__((visibility("default"))) int MPI_Testany(int count, MPI_Request array_of_requests[], int *index,
-                               int *flag, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Test(MPI_Request *request, int *flag, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Test_cancelled(MPI_Status *status, int *flag);
-__attribute__((visibility("default"))) int MPI_Testsome(int incount, MPI_Request array_of_requests[],
-                                int *outcount, int array_of_indices[],
-                                MPI_Status array_of_statuses[]);
-__attribute__((visibility("default"))) int MPI_Topo_test(MPI_Comm comm, int *status);
-__attribute__((visibility("default"))) int MPI_Type_c2f(MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_Type_commit(MPI_Datatype *type);
-__attribute__((visibility("default"))) int MPI_Type_contiguous(int count, MPI_Datatype oldtype,
-                                       MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_darray(int size, int rank, int ndims,
-                                          int gsize_array[], int distrib_array[],
-                                          int darg_array[], int psize_array[],
-                                          int order, MPI_Datatype oldtype,
-                                          MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_f90_complex(int p, int r, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_f90_integer(int r, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_f90_real(int p, int r, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_hindexed(int count, int array_of_blocklengths[],
-                                            MPI_Aint array_of_displacements[],
-                                            MPI_Datatype oldtype,
-                                            MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_hvector(int count, int blocklength, MPI_Aint stride,
-                                           MPI_Datatype oldtype,
-                                           MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_keyval(MPI_Type_copy_attr_function *type_copy_attr_fn,
-                                          MPI_Type_delete_attr_function *type_delete_attr_fn,
-                                          int *type_keyval, void *extra_state);
-__attribute__((visibility("default"))) int MPI_Type_create_indexed_block(int count, int blocklength,
-                                                 int array_of_displacements[],
-                                                 MPI_Datatype oldtype,
-                                                 MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_struct(int count, int array_of_block_lengths[],
-                                          MPI_Aint array_of_displacements[],
-                                          MPI_Datatype array_of_types[],
-                                          MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_subarray(int ndims, int size_array[], int subsize_array[],
-                                            int start_array[], int order,
-                                            MPI_Datatype oldtype, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_create_resized(MPI_Datatype oldtype, MPI_Aint lb,
-                                           MPI_Aint extent, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_delete_attr(MPI_Datatype type, int type_keyval);
-__attribute__((visibility("default"))) int MPI_Type_dup(MPI_Datatype type, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_extent(MPI_Datatype type, MPI_Aint *extent)
-                                   ;
-__attribute__((visibility("default"))) int MPI_Type_free(MPI_Datatype *type);
-__attribute__((visibility("default"))) int MPI_Type_free_keyval(int *type_keyval);
-__attribute__((visibility("default"))) MPI_Datatype MPI_Type_f2c(int datatype);
-__attribute__((visibility("default"))) int MPI_Type_get_attr(MPI_Datatype type, int type_keyval,
-                                     void *attribute_val, int *flag);
-__attribute__((visibility("default"))) int MPI_Type_get_contents(MPI_Datatype mtype, int max_integers,
-                                         int max_addresses, int max_datatypes,
-                                         int array_of_integers[],
-                                         MPI_Aint array_of_addresses[],
-                                         MPI_Datatype array_of_datatypes[]);
-__attribute__((visibility("default"))) int MPI_Type_get_envelope(MPI_Datatype type, int *num_integers,
-                                         int *num_addresses, int *num_datatypes,
-                                         int *combiner);
-__attribute__((visibility("default"))) int MPI_Type_get_extent(MPI_Datatype type, MPI_Aint *lb,
-                                       MPI_Aint *extent);
-__attribute__((visibility("default"))) int MPI_Type_get_name(MPI_Datatype type, char *type_name,
-                                     int *resultlen);
-__attribute__((visibility("default"))) int MPI_Type_get_true_extent(MPI_Datatype datatype, MPI_Aint *true_lb,
-                                            MPI_Aint *true_extent);
-__attribute__((visibility("default"))) int MPI_Type_hindexed(int count, int array_of_blocklengths[],
-                                     MPI_Aint array_of_displacements[],
-                                     MPI_Datatype oldtype, MPI_Datatype *newtype)
-                                     ;
-__attribute__((visibility("default"))) int MPI_Type_hvector(int count, int blocklength, MPI_Aint stride,
-                                    MPI_Datatype oldtype, MPI_Datatype *newtype)
-                                    ;
-__attribute__((visibility("default"))) int MPI_Type_indexed(int count, int array_of_blocklengths[],
-                                    int array_of_displacements[],
-                                    MPI_Datatype oldtype, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Type_lb(MPI_Datatype type, MPI_Aint *lb)
-                               ;
-__attribute__((visibility("default"))) int MPI_Type_match_size(int typeclass, int size, MPI_Datatype *type);
-__attribute__((visibility("default"))) int MPI_Type_set_attr(MPI_Datatype type, int type_keyval,
-                                     void *attr_val);
-__attribute__((visibility("default"))) int MPI_Type_set_name(MPI_Datatype type, char *type_name);
-__attribute__((visibility("default"))) int MPI_Type_size(MPI_Datatype type, int *size);
-__attribute__((visibility("default"))) int MPI_Type_struct(int count, int array_of_blocklengths[],
-                                   MPI_Aint array_of_displacements[],
-                                   MPI_Datatype array_of_types[],
-                                   MPI_Datatype *newtype)
-                                   ;
-__attribute__((visibility("default"))) int MPI_Type_ub(MPI_Datatype mtype, MPI_Aint *ub)
-                               ;
-__attribute__((visibility("default"))) int MPI_Type_vector(int count, int blocklength, int stride,
-                                   MPI_Datatype oldtype, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int MPI_Unpack(void *inbuf, int insize, int *position,
-                              void *outbuf, int outcount, MPI_Datatype datatype,
-                              MPI_Comm comm);
-__attribute__((visibility("default"))) int MPI_Unpublish_name(char *service_name, MPI_Info info, char *port_name);
-__attribute__((visibility("default"))) int MPI_Unpack_external (char *datarep, void *inbuf, MPI_Aint insize,
-                                        MPI_Aint *position, void *outbuf, int outcount,
-                                        MPI_Datatype datatype);
-__attribute__((visibility("default"))) int MPI_Waitall(int count, MPI_Request *array_of_requests,
-                               MPI_Status *array_of_statuses);
-__attribute__((visibility("default"))) int MPI_Waitany(int count, MPI_Request *array_of_requests,
-                               int *index, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Wait(MPI_Request *request, MPI_Status *status);
-__attribute__((visibility("default"))) int MPI_Waitsome(int incount, MPI_Request *array_of_requests,
-                                int *outcount, int *array_of_indices,
-                                MPI_Status *array_of_statuses);
-__attribute__((visibility("default"))) int MPI_Win_c2f(MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_call_errhandler(MPI_Win win, int errorcode);
-__attribute__((visibility("default"))) int MPI_Win_complete(MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_create(void *base, MPI_Aint size, int disp_unit,
-                                  MPI_Info info, MPI_Comm comm, MPI_Win *win);
-__attribute__((visibility("default"))) int MPI_Win_create_errhandler(MPI_Win_errhandler_function *function,
-                                             MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int MPI_Win_create_keyval(MPI_Win_copy_attr_function *win_copy_attr_fn,
-                                         MPI_Win_delete_attr_function *win_delete_attr_fn,
-                                         int *win_keyval, void *extra_state);
-__attribute__((visibility("default"))) int MPI_Win_delete_attr(MPI_Win win, int win_keyval);
-__attribute__((visibility("default"))) MPI_Win MPI_Win_f2c(int win);
-__attribute__((visibility("default"))) int MPI_Win_fence(int assert, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_free(MPI_Win *win);
-__attribute__((visibility("default"))) int MPI_Win_free_keyval(int *win_keyval);
-__attribute__((visibility("default"))) int MPI_Win_get_attr(MPI_Win win, int win_keyval,
-                                    void *attribute_val, int *flag);
-__attribute__((visibility("default"))) int MPI_Win_get_errhandler(MPI_Win win, MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int MPI_Win_get_group(MPI_Win win, MPI_Group *group);
-__attribute__((visibility("default"))) int MPI_Win_get_name(MPI_Win win, char *win_name, int *resultlen);
-__attribute__((visibility("default"))) int MPI_Win_lock(int lock_type, int rank, int assert, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_post(MPI_Group group, int assert, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_set_attr(MPI_Win win, int win_keyval, void *attribute_val);
-__attribute__((visibility("default"))) int MPI_Win_set_errhandler(MPI_Win win, MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int MPI_Win_set_name(MPI_Win win, char *win_name);
-__attribute__((visibility("default"))) int MPI_Win_start(MPI_Group group, int assert, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_test(MPI_Win win, int *flag);
-__attribute__((visibility("default"))) int MPI_Win_unlock(int rank, MPI_Win win);
-__attribute__((visibility("default"))) int MPI_Win_wait(MPI_Win win);
-__attribute__((visibility("default"))) double MPI_Wtick(void);
-__attribute__((visibility("default"))) double MPI_Wtime(void);
-
-
-
-
-
-__attribute__((visibility("default"))) int PMPI_Abort(MPI_Comm comm, int errorcode);
-__attribute__((visibility("default"))) int PMPI_Accumulate(void *origin_addr, int origin_count, MPI_Datatype origin_datatype,
-                                   int target_rank, MPI_Aint target_disp, int target_count,
-                                   MPI_Datatype target_datatype, MPI_Op op, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Add_error_class(int *errorclass);
-__attribute__((visibility("default"))) int PMPI_Add_error_code(int errorclass, int *errorcode);
-__attribute__((visibility("default"))) int PMPI_Add_error_string(int errorcode, char *string);
-__attribute__((visibility("default"))) int PMPI_Address(void *location, MPI_Aint *address)
-                                ;
-__attribute__((visibility("default"))) int PMPI_Allgather(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                  void *recvbuf, int recvcount,
-                                  MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Allgatherv(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                   void *recvbuf, int *recvcounts,
-                                   int *displs, MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Alloc_mem(MPI_Aint size, MPI_Info info,
-                                  void *baseptr);
-__attribute__((visibility("default"))) int PMPI_Allreduce(void *sendbuf, void *recvbuf, int count,
-                                  MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Alltoall(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                 void *recvbuf, int recvcount,
-                                 MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Alltoallv(void *sendbuf, int *sendcounts, int *sdispls,
-                                  MPI_Datatype sendtype, void *recvbuf, int *recvcounts,
-                                  int *rdispls, MPI_Datatype recvtype, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Alltoallw(void *sendbuf, int *sendcounts, int *sdispls, MPI_Datatype *sendtypes,
-                                  void *recvbuf, int *recvcounts, int *rdispls, MPI_Datatype *recvtypes,
-                                  MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Attr_delete(MPI_Comm comm, int keyval)
-                                    ;
-__attribute__((visibility("default"))) int PMPI_Attr_get(MPI_Comm comm, int keyval, void *attribute_val, int *flag)
-                                 ;
-__attribute__((visibility("default"))) int PMPI_Attr_put(MPI_Comm comm, int keyval, void *attribute_val)
-                                 ;
-__attribute__((visibility("default"))) int PMPI_Barrier(MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Bcast(void *buffer, int count, MPI_Datatype datatype,
-                              int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Bsend(void *buf, int count, MPI_Datatype datatype,
-                              int dest, int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Bsend_init(void *buf, int count, MPI_Datatype datatype,
-                                   int dest, int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Buffer_attach(void *buffer, int size);
-__attribute__((visibility("default"))) int PMPI_Buffer_detach(void *buffer, int *size);
-__attribute__((visibility("default"))) int PMPI_Cancel(MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int *coords);
-__attribute__((visibility("default"))) int PMPI_Cart_create(MPI_Comm old_comm, int ndims, int *dims,
-                                    int *periods, int reorder, MPI_Comm *comm_cart);
-__attribute__((visibility("default"))) int PMPI_Cart_get(MPI_Comm comm, int maxdims, int *dims,
-                                 int *periods, int *coords);
-__attribute__((visibility("default"))) int PMPI_Cart_map(MPI_Comm comm, int ndims, int *dims,
-                                 int *periods, int *newrank);
-__attribute__((visibility("default"))) int PMPI_Cart_rank(MPI_Comm comm, int *coords, int *rank);
-__attribute__((visibility("default"))) int PMPI_Cart_shift(MPI_Comm comm, int direction, int disp,
-                                   int *rank_source, int *rank_dest);
-__attribute__((visibility("default"))) int PMPI_Cart_sub(MPI_Comm comm, int *remain_dims, MPI_Comm *new_comm);
-__attribute__((visibility("default"))) int PMPI_Cartdim_get(MPI_Comm comm, int *ndims);
-__attribute__((visibility("default"))) int PMPI_Close_port(char *port_name);
-__attribute__((visibility("default"))) int PMPI_Comm_accept(char *port_name, MPI_Info info, int root,
-                                    MPI_Comm comm, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int PMPI_Comm_c2f(MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Comm_call_errhandler(MPI_Comm comm, int errorcode);
-__attribute__((visibility("default"))) int PMPI_Comm_compare(MPI_Comm comm1, MPI_Comm comm2, int *result);
-__attribute__((visibility("default"))) int PMPI_Comm_connect(char *port_name, MPI_Info info, int root,
-                                     MPI_Comm comm, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int PMPI_Comm_create_errhandler(MPI_Comm_errhandler_function *function,
-                                               MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int PMPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn,
-                                           MPI_Comm_delete_attr_function *comm_delete_attr_fn,
-                                           int *comm_keyval, void *extra_state);
-__attribute__((visibility("default"))) int PMPI_Comm_create(MPI_Comm comm, MPI_Group group, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int PMPI_Comm_delete_attr(MPI_Comm comm, int comm_keyval);
-__attribute__((visibility("default"))) int PMPI_Comm_disconnect(MPI_Comm *comm);
-__attribute__((visibility("default"))) int PMPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) MPI_Comm PMPI_Comm_f2c(int comm);
-__attribute__((visibility("default"))) int PMPI_Comm_free_keyval(int *comm_keyval);
-__attribute__((visibility("default"))) int PMPI_Comm_free(MPI_Comm *comm);
-__attribute__((visibility("default"))) int PMPI_Comm_get_attr(MPI_Comm comm, int comm_keyval,
-                                      void *attribute_val, int *flag);
-__attribute__((visibility("default"))) int PMPI_Comm_get_errhandler(MPI_Comm comm, MPI_Errhandler *erhandler);
-__attribute__((visibility("default"))) int PMPI_Comm_get_name(MPI_Comm comm, char *comm_name, int *resultlen);
-__attribute__((visibility("default"))) int PMPI_Comm_get_parent(MPI_Comm *parent);
-__attribute__((visibility("default"))) int PMPI_Comm_group(MPI_Comm comm, MPI_Group *group);
-__attribute__((visibility("default"))) int PMPI_Comm_join(int fd, MPI_Comm *intercomm);
-__attribute__((visibility("default"))) int PMPI_Comm_rank(MPI_Comm comm, int *rank);
-__attribute__((visibility("default"))) int PMPI_Comm_remote_group(MPI_Comm comm, MPI_Group *group);
-__attribute__((visibility("default"))) int PMPI_Comm_remote_size(MPI_Comm comm, int *size);
-__attribute__((visibility("default"))) int PMPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);
-__attribute__((visibility("default"))) int PMPI_Comm_set_errhandler(MPI_Comm comm, MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int PMPI_Comm_set_name(MPI_Comm comm, char *comm_name);
-__attribute__((visibility("default"))) int PMPI_Comm_size(MPI_Comm comm, int *size);
-__attribute__((visibility("default"))) int PMPI_Comm_spawn(char *command, char **argv, int maxprocs, MPI_Info info,
-                                   int root, MPI_Comm comm, MPI_Comm *intercomm,
-                                   int *array_of_errcodes);
-__attribute__((visibility("default"))) int PMPI_Comm_spawn_multiple(int count, char **array_of_commands, char ***array_of_argv,
-                                            int *array_of_maxprocs, MPI_Info *array_of_info,
-                                            int root, MPI_Comm comm, MPI_Comm *intercomm,
-                                            int *array_of_errcodes);
-__attribute__((visibility("default"))) int PMPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm);
-__attribute__((visibility("default"))) int PMPI_Comm_test_inter(MPI_Comm comm, int *flag);
-__attribute__((visibility("default"))) int PMPI_Dims_create(int nnodes, int ndims, int *dims);
-__attribute__((visibility("default"))) int PMPI_Errhandler_c2f(MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int PMPI_Errhandler_create(MPI_Handler_function *function,
-                                          MPI_Errhandler *errhandler)
-                                          ;
-__attribute__((visibility("default"))) MPI_Errhandler PMPI_Errhandler_f2c(int errhandler);
-__attribute__((visibility("default"))) int PMPI_Errhandler_free(MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int PMPI_Errhandler_get(MPI_Comm comm, MPI_Errhandler *errhandler)
-                                       ;
-__attribute__((visibility("default"))) int PMPI_Errhandler_set(MPI_Comm comm, MPI_Errhandler errhandler)
-                                       ;
-__attribute__((visibility("default"))) int PMPI_Error_class(int errorcode, int *errorclass);
-__attribute__((visibility("default"))) int PMPI_Error_string(int errorcode, char *string, int *resultlen);
-__attribute__((visibility("default"))) int PMPI_Exscan(void *sendbuf, void *recvbuf, int count,
-                               MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-
-__attribute__((visibility("default"))) int PMPI_File_c2f(MPI_File file);
-__attribute__((visibility("default"))) MPI_File PMPI_File_f2c(int file);
-__attribute__((visibility("default"))) int PMPI_File_call_errhandler(MPI_File fh, int errorcode);
-__attribute__((visibility("default"))) int PMPI_File_create_errhandler(MPI_File_errhandler_function *function,
-                                               MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int PMPI_File_set_errhandler( MPI_File file, MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int PMPI_File_get_errhandler( MPI_File file, MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int PMPI_File_open(MPI_Comm comm, char *filename, int amode,
-                                  MPI_Info info, MPI_File *fh);
-__attribute__((visibility("default"))) int PMPI_File_close(MPI_File *fh);
-__attribute__((visibility("default"))) int PMPI_File_delete(char *filename, MPI_Info info);
-__attribute__((visibility("default"))) int PMPI_File_set_size(MPI_File fh, MPI_Offset size);
-__attribute__((visibility("default"))) int PMPI_File_preallocate(MPI_File fh, MPI_Offset size);
-__attribute__((visibility("default"))) int PMPI_File_get_size(MPI_File fh, MPI_Offset *size);
-__attribute__((visibility("default"))) int PMPI_File_get_group(MPI_File fh, MPI_Group *group);
-__attribute__((visibility("default"))) int PMPI_File_get_amode(MPI_File fh, int *amode);
-__attribute__((visibility("default"))) int PMPI_File_set_info(MPI_File fh, MPI_Info info);
-__attribute__((visibility("default"))) int PMPI_File_get_info(MPI_File fh, MPI_Info *info_used);
-__attribute__((visibility("default"))) int PMPI_File_set_view(MPI_File fh, MPI_Offset disp, MPI_Datatype etype,
-                                      MPI_Datatype filetype, char *datarep, MPI_Info info);
-__attribute__((visibility("default"))) int PMPI_File_get_view(MPI_File fh, MPI_Offset *disp,
-                                      MPI_Datatype *etype,
-                                      MPI_Datatype *filetype, char *datarep);
-__attribute__((visibility("default"))) int PMPI_File_read_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                     int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_read_at_all(MPI_File fh, MPI_Offset offset, void *buf,
-                                         int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                      int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_at_all(MPI_File fh, MPI_Offset offset, void *buf,
-                                          int count, MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_iread_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                      int count, MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_File_iwrite_at(MPI_File fh, MPI_Offset offset, void *buf,
-                                       int count, MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_File_read(MPI_File fh, void *buf, int count,
-                                  MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_read_all(MPI_File fh, void *buf, int count,
-                                      MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write(MPI_File fh, void *buf, int count,
-                                   MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_all(MPI_File fh, void *buf, int count,
-                                       MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_iread(MPI_File fh, void *buf, int count,
-                                   MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_File_iwrite(MPI_File fh, void *buf, int count,
-                                    MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_File_seek(MPI_File fh, MPI_Offset offset, int whence);
-__attribute__((visibility("default"))) int PMPI_File_get_position(MPI_File fh, MPI_Offset *offset);
-__attribute__((visibility("default"))) int PMPI_File_get_byte_offset(MPI_File fh, MPI_Offset offset,
-                                             MPI_Offset *disp);
-__attribute__((visibility("default"))) int PMPI_File_read_shared(MPI_File fh, void *buf, int count,
-                                         MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_shared(MPI_File fh, void *buf, int count,
-                                          MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_iread_shared(MPI_File fh, void *buf, int count,
-                                          MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_File_iwrite_shared(MPI_File fh, void *buf, int count,
-                                           MPI_Datatype datatype, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_File_read_ordered(MPI_File fh, void *buf, int count,
-                                          MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_ordered(MPI_File fh, void *buf, int count,
-                                           MPI_Datatype datatype, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_seek_shared(MPI_File fh, MPI_Offset offset, int whence);
-__attribute__((visibility("default"))) int PMPI_File_get_position_shared(MPI_File fh, MPI_Offset *offset);
-__attribute__((visibility("default"))) int PMPI_File_read_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf,
-                                               int count, MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_File_read_at_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_at_all_begin(MPI_File fh, MPI_Offset offset, void *buf,
-                                                int count, MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_File_write_at_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_read_all_begin(MPI_File fh, void *buf, int count,
-                                            MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_File_read_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_all_begin(MPI_File fh, void *buf, int count,
-                                             MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_File_write_all_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_read_ordered_begin(MPI_File fh, void *buf, int count,
-                                                MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_File_read_ordered_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_write_ordered_begin(MPI_File fh, void *buf, int count,
-                                                 MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_File_write_ordered_end(MPI_File fh, void *buf, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_File_get_type_extent(MPI_File fh, MPI_Datatype datatype,
-                                             MPI_Aint *extent);
-__attribute__((visibility("default"))) int PMPI_File_set_atomicity(MPI_File fh, int flag);
-__attribute__((visibility("default"))) int PMPI_File_get_atomicity(MPI_File fh, int *flag);
-__attribute__((visibility("default"))) int PMPI_File_sync(MPI_File fh);
-
-__attribute__((visibility("default"))) int PMPI_Finalize(void);
-__attribute__((visibility("default"))) int PMPI_Finalized(int *flag);
-__attribute__((visibility("default"))) int PMPI_Free_mem(void *base);
-__attribute__((visibility("default"))) int PMPI_Gather(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                               void *recvbuf, int recvcount, MPI_Datatype recvtype,
-                               int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Gatherv(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                void *recvbuf, int *recvcounts, int *displs,
-                                MPI_Datatype recvtype, int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Get_address(void *location, MPI_Aint *address);
-__attribute__((visibility("default"))) int PMPI_Get_count(MPI_Status *status, MPI_Datatype datatype, int *count);
-__attribute__((visibility("default"))) int PMPI_Get_elements(MPI_Status *status, MPI_Datatype datatype,
-                                     int *count);
-__attribute__((visibility("default"))) int PMPI_Get(void *origin_addr, int origin_count,
-                            MPI_Datatype origin_datatype, int target_rank,
-                            MPI_Aint target_disp, int target_count,
-                            MPI_Datatype target_datatype, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Get_processor_name(char *name, int *resultlen);
-__attribute__((visibility("default"))) int PMPI_Get_version(int *version, int *subversion);
-__attribute__((visibility("default"))) int PMPI_Graph_create(MPI_Comm comm_old, int nnodes, int *index,
-                                     int *edges, int reorder, MPI_Comm *comm_graph);
-__attribute__((visibility("default"))) int PMPI_Graph_get(MPI_Comm comm, int maxindex, int maxedges,
-                                  int *index, int *edges);
-__attribute__((visibility("default"))) int PMPI_Graph_map(MPI_Comm comm, int nnodes, int *index, int *edges,
-                                  int *newrank);
-__attribute__((visibility("default"))) int PMPI_Graph_neighbors_count(MPI_Comm comm, int rank, int *nneighbors);
-__attribute__((visibility("default"))) int PMPI_Graph_neighbors(MPI_Comm comm, int rank, int maxneighbors,
-                                        int *neighbors);
-__attribute__((visibility("default"))) int PMPI_Graphdims_get(MPI_Comm comm, int *nnodes, int *nedges);
-__attribute__((visibility("default"))) int PMPI_Grequest_complete(MPI_Request request);
-__attribute__((visibility("default"))) int PMPI_Grequest_start(MPI_Grequest_query_function *query_fn,
-                                       MPI_Grequest_free_function *free_fn,
-                                       MPI_Grequest_cancel_function *cancel_fn,
-                                       void *extra_state, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Group_c2f(MPI_Group group);
-__attribute__((visibility("default"))) int PMPI_Group_compare(MPI_Group group1, MPI_Group group2, int *result);
-__attribute__((visibility("default"))) int PMPI_Group_difference(MPI_Group group1, MPI_Group group2,
-                                         MPI_Group *newgroup);
-__attribute__((visibility("default"))) int PMPI_Group_excl(MPI_Group group, int n, int *ranks,
-                                   MPI_Group *newgroup);
-__attribute__((visibility("default"))) MPI_Group PMPI_Group_f2c(int group);
-__attribute__((visibility("default"))) int PMPI_Group_free(MPI_Group *group);
-__attribute__((visibility("default"))) int PMPI_Group_incl(MPI_Group group, int n, int *ranks,
-                                   MPI_Group *newgroup);
-__attribute__((visibility("default"))) int PMPI_Group_intersection(MPI_Group group1, MPI_Group group2,
-                                           MPI_Group *newgroup);
-__attribute__((visibility("default"))) int PMPI_Group_range_excl(MPI_Group group, int n, int ranges[][3],
-                                         MPI_Group *newgroup);
-__attribute__((visibility("default"))) int PMPI_Group_range_incl(MPI_Group group, int n, int ranges[][3],
-                                         MPI_Group *newgroup);
-__attribute__((visibility("default"))) int PMPI_Group_rank(MPI_Group group, int *rank);
-__attribute__((visibility("default"))) int PMPI_Group_size(MPI_Group group, int *size);
-__attribute__((visibility("default"))) int PMPI_Group_translate_ranks(MPI_Group group1, int n, int *ranks1,
-                                              MPI_Group group2, int *ranks2);
-__attribute__((visibility("default"))) int PMPI_Group_union(MPI_Group group1, MPI_Group group2,
-                                    MPI_Group *newgroup);
-__attribute__((visibility("default"))) int PMPI_Ibsend(void *buf, int count, MPI_Datatype datatype, int dest,
-                               int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Info_c2f(MPI_Info info);
-__attribute__((visibility("default"))) int PMPI_Info_create(MPI_Info *info);
-__attribute__((visibility("default"))) int PMPI_Info_delete(MPI_Info info, char *key);
-__attribute__((visibility("default"))) int PMPI_Info_dup(MPI_Info info, MPI_Info *newinfo);
-__attribute__((visibility("default"))) MPI_Info PMPI_Info_f2c(int info);
-__attribute__((visibility("default"))) int PMPI_Info_free(MPI_Info *info);
-__attribute__((visibility("default"))) int PMPI_Info_get(MPI_Info info, char *key, int valuelen,
-                                 char *value, int *flag);
-__attribute__((visibility("default"))) int PMPI_Info_get_nkeys(MPI_Info info, int *nkeys);
-__attribute__((visibility("default"))) int PMPI_Info_get_nthkey(MPI_Info info, int n, char *key);
-__attribute__((visibility("default"))) int PMPI_Info_get_valuelen(MPI_Info info, char *key, int *valuelen,
-                                          int *flag);
-__attribute__((visibility("default"))) int PMPI_Info_set(MPI_Info info, char *key, char *value);
-__attribute__((visibility("default"))) int PMPI_Init(int *argc, char ***argv);
-__attribute__((visibility("default"))) int PMPI_Initialized(int *flag);
-__attribute__((visibility("default"))) int PMPI_Init_thread(int *argc, char ***argv, int required,
-                                    int *provided);
-__attribute__((visibility("default"))) int PMPI_Intercomm_create(MPI_Comm local_comm, int local_leader,
-                                         MPI_Comm bridge_comm, int remote_leader,
-                                         int tag, MPI_Comm *newintercomm);
-__attribute__((visibility("default"))) int PMPI_Intercomm_merge(MPI_Comm intercomm, int high,
-                                        MPI_Comm *newintercomm);
-__attribute__((visibility("default"))) int PMPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag,
-                               MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source,
-                              int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Irsend(void *buf, int count, MPI_Datatype datatype, int dest,
-                               int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Isend(void *buf, int count, MPI_Datatype datatype, int dest,
-                              int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Issend(void *buf, int count, MPI_Datatype datatype, int dest,
-                               int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Is_thread_main(int *flag);
-__attribute__((visibility("default"))) int PMPI_Keyval_create(MPI_Copy_function *copy_fn,
-                                      MPI_Delete_function *delete_fn,
-                                      int *keyval, void *extra_state)
-                                      ;
-__attribute__((visibility("default"))) int PMPI_Keyval_free(int *keyval)
-                                    ;
-__attribute__((visibility("default"))) int PMPI_Lookup_name(char *service_name, MPI_Info info, char *port_name);
-__attribute__((visibility("default"))) int PMPI_Op_c2f(MPI_Op op);
-__attribute__((visibility("default"))) int PMPI_Op_commutative(MPI_Op op, int *commute);
-__attribute__((visibility("default"))) int PMPI_Op_create(MPI_User_function *function, int commute, MPI_Op *op);
-__attribute__((visibility("default"))) int PMPI_Open_port(MPI_Info info, char *port_name);
-__attribute__((visibility("default"))) MPI_Op PMPI_Op_f2c(int op);
-__attribute__((visibility("default"))) int PMPI_Op_free(MPI_Op *op);
-__attribute__((visibility("default"))) int PMPI_Pack_external(char *datarep, void *inbuf, int incount,
-                                      MPI_Datatype datatype, void *outbuf,
-                                      MPI_Aint outsize, MPI_Aint *position);
-__attribute__((visibility("default"))) int PMPI_Pack_external_size(char *datarep, int incount,
-                                           MPI_Datatype datatype, MPI_Aint *size);
-__attribute__((visibility("default"))) int PMPI_Pack(void *inbuf, int incount, MPI_Datatype datatype,
-                             void *outbuf, int outsize, int *position, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Pack_size(int incount, MPI_Datatype datatype, MPI_Comm comm,
-                                  int *size);
-__attribute__((visibility("default"))) int PMPI_Pcontrol(const int level, ...);
-__attribute__((visibility("default"))) int PMPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Publish_name(char *service_name, MPI_Info info,
-                                     char *port_name);
-__attribute__((visibility("default"))) int PMPI_Put(void *origin_addr, int origin_count, MPI_Datatype origin_datatype,
-                            int target_rank, MPI_Aint target_disp, int target_count,
-                            MPI_Datatype target_datatype, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Query_thread(int *provided);
-__attribute__((visibility("default"))) int PMPI_Recv_init(void *buf, int count, MPI_Datatype datatype, int source,
-                                  int tag, MPI_Comm comm, MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Recv(void *buf, int count, MPI_Datatype datatype, int source,
-                             int tag, MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Reduce(void *sendbuf, void *recvbuf, int count,
-                               MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Reduce_local(void *inbuf, void *inoutbuf, int count,
-                                     MPI_Datatype datatype, MPI_Op);
-__attribute__((visibility("default"))) int PMPI_Reduce_scatter(void *sendbuf, void *recvbuf, int *recvcounts,
-                                       MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Register_datarep(char *datarep,
-                                         MPI_Datarep_conversion_function *read_conversion_fn,
-                                         MPI_Datarep_conversion_function *write_conversion_fn,
-                                         MPI_Datarep_extent_function *dtype_file_extent_fn,
-                                         void *extra_state);
-__attribute__((visibility("default"))) int PMPI_Request_c2f(MPI_Request request);
-__attribute__((visibility("default"))) MPI_Request PMPI_Request_f2c(int request);
-__attribute__((visibility("default"))) int PMPI_Request_free(MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Request_get_status(MPI_Request request, int *flag,
-                                           MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Rsend(void *ibuf, int count, MPI_Datatype datatype, int dest,
-                              int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Rsend_init(void *buf, int count, MPI_Datatype datatype,
-                                   int dest, int tag, MPI_Comm comm,
-                                   MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Scan(void *sendbuf, void *recvbuf, int count,
-                             MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Scatter(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                void *recvbuf, int recvcount, MPI_Datatype recvtype,
-                                int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Scatterv(void *sendbuf, int *sendcounts, int *displs,
-                                 MPI_Datatype sendtype, void *recvbuf, int recvcount,
-                                 MPI_Datatype recvtype, int root, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Send_init(void *buf, int count, MPI_Datatype datatype,
-                                  int dest, int tag, MPI_Comm comm,
-                                  MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Send(void *buf, int count, MPI_Datatype datatype, int dest,
-                             int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Sendrecv(void *sendbuf, int sendcount, MPI_Datatype sendtype,
-                                 int dest, int sendtag, void *recvbuf, int recvcount,
-                                 MPI_Datatype recvtype, int source, int recvtag,
-                                 MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Sendrecv_replace(void * buf, int count, MPI_Datatype datatype,
-                                         int dest, int sendtag, int source, int recvtag,
-                                         MPI_Comm comm, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Ssend_init(void *buf, int count, MPI_Datatype datatype,
-                                   int dest, int tag, MPI_Comm comm,
-                                   MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Ssend(void *buf, int count, MPI_Datatype datatype, int dest,
-                              int tag, MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Start(MPI_Request *request);
-__attribute__((visibility("default"))) int PMPI_Startall(int count, MPI_Request *array_of_requests);
-__attribute__((visibility("default"))) int PMPI_Status_c2f(MPI_Status *c_status, int *f_status);
-__attribute__((visibility("default"))) int PMPI_Status_f2c(int *f_status, MPI_Status *c_status);
-__attribute__((visibility("default"))) int PMPI_Status_set_cancelled(MPI_Status *status, int flag);
-__attribute__((visibility("default"))) int PMPI_Status_set_elements(MPI_Status *status, MPI_Datatype datatype,
-                                            int count);
-__attribute__((visibility("default"))) int PMPI_Testall(int count, MPI_Request array_of_requests[], int *flag,
-                                MPI_Status array_of_statuses[]);
-__attribute__((visibility("default"))) int PMPI_Testany(int count, MPI_Request array_of_requests[], int *index, int *flag, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Test(MPI_Request *request, int *flag, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Test_cancelled(MPI_Status *status, int *flag);
-__attribute__((visibility("default"))) int PMPI_Testsome(int incount, MPI_Request array_of_requests[],
-                                 int *outcount, int array_of_indices[],
-                                 MPI_Status array_of_statuses[]);
-__attribute__((visibility("default"))) int PMPI_Topo_test(MPI_Comm comm, int *status);
-__attribute__((visibility("default"))) int PMPI_Type_c2f(MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_Type_commit(MPI_Datatype *type);
-__attribute__((visibility("default"))) int PMPI_Type_contiguous(int count, MPI_Datatype oldtype,
-                                        MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_darray(int size, int rank, int ndims,
-                                           int gsize_array[], int distrib_array[],
-                                           int darg_array[], int psize_array[],
-                                           int order, MPI_Datatype oldtype,
-                                           MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_f90_complex(int p, int r, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_f90_integer(int r, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_f90_real(int p, int r, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_hindexed(int count, int array_of_blocklengths[],
-                                             MPI_Aint array_of_displacements[],
-                                             MPI_Datatype oldtype,
-                                             MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_hvector(int count, int blocklength, MPI_Aint stride,
-                                            MPI_Datatype oldtype,
-                                            MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_keyval(MPI_Type_copy_attr_function *type_copy_attr_fn,
-                                           MPI_Type_delete_attr_function *type_delete_attr_fn,
-                                           int *type_keyval, void *extra_state);
-__attribute__((visibility("default"))) int PMPI_Type_create_indexed_block(int count, int blocklength,
-                                                  int array_of_displacements[],
-                                                  MPI_Datatype oldtype,
-                                                  MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_struct(int count, int array_of_block_lengths[],
-                                           MPI_Aint array_of_displacements[],
-                                           MPI_Datatype array_of_types[],
-                                           MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_subarray(int ndims, int size_array[], int subsize_array[],
-                                             int start_array[], int order,
-                                             MPI_Datatype oldtype, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_create_resized(MPI_Datatype oldtype, MPI_Aint lb,
-                                            MPI_Aint extent, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_delete_attr(MPI_Datatype type, int type_keyval);
-__attribute__((visibility("default"))) int PMPI_Type_dup(MPI_Datatype type, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_extent(MPI_Datatype type, MPI_Aint *extent)
-                                    ;
-__attribute__((visibility("default"))) int PMPI_Type_free(MPI_Datatype *type);
-__attribute__((visibility("default"))) int PMPI_Type_free_keyval(int *type_keyval);
-__attribute__((visibility("default"))) MPI_Datatype PMPI_Type_f2c(int datatype);
-__attribute__((visibility("default"))) int PMPI_Type_get_attr(MPI_Datatype type, int type_keyval,
-                                      void *attribute_val, int *flag);
-__attribute__((visibility("default"))) int PMPI_Type_get_contents(MPI_Datatype mtype, int max_integers,
-                                          int max_addresses, int max_datatypes,
-                                          int array_of_integers[],
-                                          MPI_Aint array_of_addresses[],
-                                          MPI_Datatype array_of_datatypes[]);
-__attribute__((visibility("default"))) int PMPI_Type_get_envelope(MPI_Datatype type, int *num_integers,
-                                          int *num_addresses, int *num_datatypes,
-                                          int *combiner);
-__attribute__((visibility("default"))) int PMPI_Type_get_extent(MPI_Datatype type, MPI_Aint *lb,
-                                        MPI_Aint *extent);
-__attribute__((visibility("default"))) int PMPI_Type_get_name(MPI_Datatype type, char *type_name,
-                                      int *resultlen);
-__attribute__((visibility("default"))) int PMPI_Type_get_true_extent(MPI_Datatype datatype, MPI_Aint *true_lb,
-                                             MPI_Aint *true_extent);
-__attribute__((visibility("default"))) int PMPI_Type_hindexed(int count, int array_of_blocklengths[],
-                                      MPI_Aint array_of_displacements[],
-                                      MPI_Datatype oldtype, MPI_Datatype *newtype)
-                                      ;
-__attribute__((visibility("default"))) int PMPI_Type_hvector(int count, int blocklength, MPI_Aint stride,
-                                     MPI_Datatype oldtype, MPI_Datatype *newtype)
-                                     ;
-__attribute__((visibility("default"))) int PMPI_Type_indexed(int count, int array_of_blocklengths[],
-                                     int array_of_displacements[],
-                                     MPI_Datatype oldtype, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Type_lb(MPI_Datatype type, MPI_Aint *lb)
-                                ;
-__attribute__((visibility("default"))) int PMPI_Type_match_size(int typeclass, int size, MPI_Datatype *type);
-__attribute__((visibility("default"))) int PMPI_Type_set_attr(MPI_Datatype type, int type_keyval,
-                                      void *attr_val);
-__attribute__((visibility("default"))) int PMPI_Type_set_name(MPI_Datatype type, char *type_name);
-__attribute__((visibility("default"))) int PMPI_Type_size(MPI_Datatype type, int *size);
-__attribute__((visibility("default"))) int PMPI_Type_struct(int count, int array_of_blocklengths[],
-                                    MPI_Aint array_of_displacements[],
-                                    MPI_Datatype array_of_types[],
-                                    MPI_Datatype *newtype)
-                                    ;
-__attribute__((visibility("default"))) int PMPI_Type_ub(MPI_Datatype mtype, MPI_Aint *ub)
-                                ;
-__attribute__((visibility("default"))) int PMPI_Type_vector(int count, int blocklength, int stride,
-                                    MPI_Datatype oldtype, MPI_Datatype *newtype);
-__attribute__((visibility("default"))) int PMPI_Unpack(void *inbuf, int insize, int *position,
-                               void *outbuf, int outcount, MPI_Datatype datatype,
-                               MPI_Comm comm);
-__attribute__((visibility("default"))) int PMPI_Unpublish_name(char *service_name, MPI_Info info,
-                                       char *port_name);
-__attribute__((visibility("default"))) int PMPI_Unpack_external (char *datarep, void *inbuf, MPI_Aint insize,
-                                         MPI_Aint *position, void *outbuf, int outcount,
-                                         MPI_Datatype datatype);
-__attribute__((visibility("default"))) int PMPI_Waitall(int count, MPI_Request *array_of_requests,
-                                MPI_Status *array_of_statuses);
-__attribute__((visibility("default"))) int PMPI_Waitany(int count, MPI_Request *array_of_requests,
-                                int *index, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Wait(MPI_Request *request, MPI_Status *status);
-__attribute__((visibility("default"))) int PMPI_Waitsome(int incount, MPI_Request *array_of_requests,
-                                 int *outcount, int *array_of_indices,
-                                 MPI_Status *array_of_statuses);
-__attribute__((visibility("default"))) int PMPI_Win_c2f(MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_call_errhandler(MPI_Win win, int errorcode);
-__attribute__((visibility("default"))) int PMPI_Win_complete(MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_create(void *base, MPI_Aint size, int disp_unit,
-                                   MPI_Info info, MPI_Comm comm, MPI_Win *win);
-__attribute__((visibility("default"))) int PMPI_Win_create_errhandler(MPI_Win_errhandler_function *function,
-                                              MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int PMPI_Win_create_keyval(MPI_Win_copy_attr_function *win_copy_attr_fn,
-                                          MPI_Win_delete_attr_function *win_delete_attr_fn,
-                                          int *win_keyval, void *extra_state);
-__attribute__((visibility("default"))) int PMPI_Win_delete_attr(MPI_Win win, int win_keyval);
-__attribute__((visibility("default"))) MPI_Win PMPI_Win_f2c(int win);
-__attribute__((visibility("default"))) int PMPI_Win_fence(int assert, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_free(MPI_Win *win);
-__attribute__((visibility("default"))) int PMPI_Win_free_keyval(int *win_keyval);
-__attribute__((visibility("default"))) int PMPI_Win_get_attr(MPI_Win win, int win_keyval,
-                                     void *attribute_val, int *flag);
-__attribute__((visibility("default"))) int PMPI_Win_get_errhandler(MPI_Win win, MPI_Errhandler *errhandler);
-__attribute__((visibility("default"))) int PMPI_Win_get_group(MPI_Win win, MPI_Group *group);
-__attribute__((visibility("default"))) int PMPI_Win_get_name(MPI_Win win, char *win_name, int *resultlen);
-__attribute__((visibility("default"))) int PMPI_Win_lock(int lock_type, int rank, int assert, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_post(MPI_Group group, int assert, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_set_attr(MPI_Win win, int win_keyval, void *attribute_val);
-__attribute__((visibility("default"))) int PMPI_Win_set_errhandler(MPI_Win win, MPI_Errhandler errhandler);
-__attribute__((visibility("default"))) int PMPI_Win_set_name(MPI_Win win, char *win_name);
-__attribute__((visibility("default"))) int PMPI_Win_start(MPI_Group group, int assert, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_test(MPI_Win win, int *flag);
-__attribute__((visibility("default"))) int PMPI_Win_unlock(int rank, MPI_Win win);
-__attribute__((visibility("default"))) int PMPI_Win_wait(MPI_Win win);
-__attribute__((visibility("default"))) double PMPI_Wtick(void);
-__attribute__((visibility("default"))) double PMPI_Wtime(void);
-# 7 "mpi_skeleton.c" 2
-# 1 "./utils.h" 1
-
-
-
-
-
-
-double max ( double a, double b );
-int converge ( double ** u_previous, double ** u_current, int X, int Y );
-double ** allocate2d ( int dimX, int dimY );
-void init2d ( double ** array, int dimX, int dimY );
-void zero2d ( double ** array, int dimX, int dimY );
-void print2d ( double ** array, int dimX, int dimY );
-void fprint2d ( char * s, double ** array, int dimX, int dimY );
-void free2d ( double ** array, int dimX, int dimY );
-# 8 "mpi_skeleton.c" 2
-
-
-
-void Jacobi(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max)
-{
-    int i, j;
-    for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1]) / 4.0;
-}
-
-void GaussSeidel(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
-{
-    int i, j;
-    for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            u_current[i][j] = u_previous[i][j] + (u_current[i - 1][j] + u_previous[i + 1][j] + u_current[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]) * omega / 4.0;
-}
-
-void RedSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
-{
-    int i, j;
-    for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            if ((i + j) % 2 == 0)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_previous[i - 1][j] + u_previous[i + 1][j] + u_previous[i][j - 1] + u_previous[i][j + 1] - 4 * u_previous[i][j]);
-}
-
-void BlackSOR(double ** u_previous, double ** u_current, int X_min, int X_max, int Y_min, int Y_max, double omega)
-{
-    int i, j;
-    for (i = X_min; i < X_max; i++)
-        for (j = Y_min; j < Y_max; j++)
-            if ((i + j) % 2 == 1)
-                u_current[i][j] = u_previous[i][j] + (omega / 4.0) * (u_current[i - 1][j] + u_current[i + 1][j] + u_current[i][j - 1] + u_current[i][j + 1] - 4 * u_previous[i][j]);
-}
-
-
-int main(int argc, char ** argv)
-{
-    int rank, size;
-    int global[2], local[2];
-    int global_padded[2];
-    int grid[2];
-    int i, j, t;
-    int global_converged = 0, converged = 0;
-    MPI_Datatype dummy;
-    double omega;
-
-    struct timeval tts, ttf, tcs, tcf;
-    double ttotal = 0, tcomp = 0, total_time, comp_time;
-
-    double ** U, ** u_current, ** u_previous, ** swap;
-
-
-    MPI_Init(&argc, &argv);
-    MPI_Comm_size(((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &size);
-    MPI_Comm_rank(((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &rank);
-
-
-
-    if (argc != 5)
-        {
-            fprintf(stderr, "Usage: mpirun .... ./exec X Y Px Py \n");
-            exit(-1);
-        }
-    else
-        {
-            global[0] = atoi(argv[1]);
-            global[1] = atoi(argv[2]);
-            grid[0] = atoi(argv[3]);
-            grid[1] = atoi(argv[4]);
-        }
-
-
-
-
-    MPI_Comm CART_COMM;
-    int periods[2] = {0, 0};
-    int rank_grid[2];
-
-    MPI_Cart_create(((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), 2, grid, periods, 0, &CART_COMM);
-    MPI_Cart_coords(CART_COMM, rank, 2, rank_grid);
-
-    MPI_Barrier(CART_COMM);
-    MPI_Barrier(((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-
-
-
-
-    for (i = 0; i < 2; i++)
-        {
-            if (global[i] % grid[i] == 0)
-                {
-                    local[i] = global[i] / grid[i];
-                    global_padded[i] = global[i];
-                }
-            else
-                {
-                    local[i] = (global[i] / grid[i]) + 1;
-                    global_padded[i] = local[i] * grid[i];
-                }
-        }
-
-
-    omega = 1.7;
-# 122 "mpi_skeleton.c"
-    if (rank == 0)
-        {
-            U = allocate2d(global_padded[0], global_padded[1]);
-            init2d(U, global[0], global[1]);
-        }
-
-
-
-
-    u_previous = allocate2d(local[0] + 2, local[1] + 2);
-    u_current = allocate2d(local[0] + 2, local[1] + 2);
-# 141 "mpi_skeleton.c"
-    MPI_Datatype global_block;
-    MPI_Type_vector(local[0], local[1], global_padded[1], ((MPI_Datatype) ((void *) &(ompi_mpi_double))), &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &global_block);
-    MPI_Type_commit(&global_block);
-
-
-
-    MPI_Datatype local_block;
-    MPI_Type_vector(local[0], local[1], local[1] + 2, ((MPI_Datatype) ((void *) &(ompi_mpi_double))), &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &local_block);
-    MPI_Type_commit(&local_block);
-
-
-    int * scatteroffset, * scattercounts;
-    if (rank == 0)
-        {
-            scatteroffset = (int*)malloc(size * sizeof(int));
-            scattercounts = (int*)malloc(size * sizeof(int));
-            for (i = 0; i < grid[0]; i++)
-                for (j = 0; j < grid[1]; j++)
-                    {
-                        scattercounts[i * grid[1] + j] = 1;
-                        scatteroffset[i * grid[1] + j] = (local[0] * local[1] * grid[1] * i + local[1] * j);
-                    }
-        }
-
-
-
-
-    double * initaddr;
-    if (rank == 0)
-        initaddr = &(U[0][0]);
-
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_previous[1][1]), 1, local_block, 0, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-    MPI_Scatterv(initaddr, scattercounts, scatteroffset, global_block, &(u_current[1][1]), 1, local_block, 0, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-
-    if (rank == 0)
-        free2d(U, global_padded[0], global_padded[1]);
-
-
-    MPI_Datatype mat_row;
-    MPI_Type_vector(1, local[1], 0, ((MPI_Datatype) ((void *) &(ompi_mpi_double))), &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_row);
-    MPI_Type_commit(&mat_row);
-
-    MPI_Datatype mat_column;
-    MPI_Type_vector(local[0], 1, local[1] + 2, ((MPI_Datatype) ((void *) &(ompi_mpi_double))), &dummy);
-    MPI_Type_create_resized(dummy, 0, sizeof(double), &mat_column);
-    MPI_Type_commit(&mat_column);
-
-
-
-
-
-
-
-    int north, south, east, west;
-
-
-
-    north = -1;
-    south = -1;
-    east = -1;
-    west = -1;
-
-
-    if (rank_grid[0] - 1 >= 0)
-        {
-            int npos[2] = {rank_grid[0] - 1, rank_grid[1]};
-            MPI_Cart_rank(CART_COMM, npos , &north);
-        }
-
-
-    if (rank_grid[0] + 1 <= grid[0] - 1)
-        {
-            int npos[2] = {rank_grid[0] + 1, rank_grid[1]};
-            MPI_Cart_rank(CART_COMM, npos, &south);
-        }
-
-
-    if (rank_grid[1] + 1 <= grid[1] - 1)
-        {
-            int npos[2] = {rank_grid[0], rank_grid[1] + 1};
-            MPI_Cart_rank(CART_COMM, npos, &east);
-        }
-
-
-    if (rank_grid[1] - 1 >= 0)
-        {
-            int npos[2] = {rank_grid[0], rank_grid[1] - 1};
-            MPI_Cart_rank(CART_COMM, npos, &west);
-        }
-# 241 "mpi_skeleton.c"
-    int i_min, i_max, j_min, j_max;
-# 250 "mpi_skeleton.c"
-    i_min = 1;
-    i_max = local[0] + 1;
-
-    j_min = 1;
-    j_max = local[1] + 1;
-
-
-
-
-    if (north == -1)
-        {
-            i_min += 1;
-        }
-    if (south == -1)
-        {
-            i_max -= 1;
-        }
-    if (west == -1)
-        {
-            j_min += 1;
-        }
-    if (east == -1)
-        {
-            j_max -= 1;
-        }
-
-
-    if (rank_grid[0] == grid[0] - 1)
-        {
-            i_max -= global_padded[0] - global[0];
-        }
-
-    if (rank_grid[1] == grid[1] - 1)
-        {
-            j_max -= global_padded[1] - global[1];
-        }
-
-
-
-    printf("Process (%d, %d) R: %2d Neighbors: N: %2d S: %2d E: %2d W: %2d Working Size: %d x %d Imin %d, Imax %d, Jmin %d, Jmax %d\n",
-           rank_grid[0], rank_grid[1], rank, north, south, east, west, local[0] + 2, local[1] + 2, i_min, i_max, j_min, j_max);
-
-
-
-
-
-
-    MPI_Request mpi_reqns_1, mpi_reqns_2;
-    MPI_Request mpi_reqew_1, mpi_reqew_2;
-    MPI_Status mpistatus;
-
-    gettimeofday(&tts, ((void *)0));
-
-
-
-
-
-
-
-            for (t = 0; t < 65536; t++)
-                {
-
-
-
-                    swap = u_previous;
-                    u_previous = u_current;
-                    u_current = swap;
-# 328 "mpi_skeleton.c"
-                    if (north != -1 || south != -1)
-                        {
-                            if (north != -1)
-                                {
-
-                                    MPI_Isend(&u_previous[1][1], 1, mat_row, north, 50, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqns_1);
-
-                                    MPI_Irecv(&u_previous[0][1], 1, mat_row, north, 60, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqns_2);
-                                }
-                            if (south != -1)
-                                {
-
-                                    MPI_Isend(&u_previous[i_max - 1][1], 1, mat_row, south, 60, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqns_2);
-
-                                    MPI_Irecv(&u_previous[i_max][1], 1, mat_row, south, 50, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqns_1);
-                                }
-
-                            MPI_Wait(&mpi_reqns_1, &mpistatus);
-                            MPI_Wait(&mpi_reqns_2, &mpistatus);
-                        }
-
-                    if (east != -1 || west != -1)
-                        {
-                            if (east != -1)
-                                {
-
-                                    MPI_Isend(&u_previous[i_min][j_max - 1], 1, mat_column, east, 70, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqew_1);
-
-                                    MPI_Irecv(&u_previous[i_min][j_max], 1, mat_column, east, 80, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqew_2);
-                                }
-                            if (west != -1)
-                                {
-                                    MPI_Isend(&u_previous[i_min][j_min], 1, mat_column, west, 80, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqew_2);
-
-                                    MPI_Irecv(&u_previous[i_min][0], 1, mat_column, west, 70, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))), &mpi_reqew_1);
-                                }
-
-                            MPI_Wait(&mpi_reqew_1, &mpistatus);
-                            MPI_Wait(&mpi_reqew_2, &mpistatus);
-                        }
-
-
-
-                    gettimeofday(&tcs, ((void *)0));
-
-
-
-
-
-
-                    gettimeofday(&tcf, ((void *)0));
-
-                    tcomp = (tcomp + (tcf.tv_sec - tcs.tv_sec) + (tcf.tv_usec - tcs.tv_usec) * 0.000001) / 2.;
-# 396 "mpi_skeleton.c"
-                }
-            printf("Rank: %d,  Done Computing\n", rank);
-            gettimeofday(&ttf, ((void *)0));
-
-            ttotal = (ttf.tv_sec - tts.tv_sec) + (ttf.tv_usec - tts.tv_usec) * 0.000001;
-
-            MPI_Barrier(((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-
-
-            MPI_Reduce(&ttotal, &total_time, 1, ((MPI_Datatype) ((void *) &(ompi_mpi_double))), ((MPI_Op) ((void *) &(ompi_mpi_op_max))), 0, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-            MPI_Reduce(&tcomp, &comp_time, 1, ((MPI_Datatype) ((void *) &(ompi_mpi_double))), ((MPI_Op) ((void *) &(ompi_mpi_op_max))), 0, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-
-
-
-
-            if (rank == 0)
-                {
-                    U = allocate2d(global_padded[0], global_padded[1]);
-                    initaddr = &(U[0][0]);
-                    printf("Value of T : %d\n", 65536);
-                }
-
-
-
-
-            MPI_Gatherv(&(u_current[1][1]), 1, local_block, initaddr, scattercounts, scatteroffset, global_block, 0, ((MPI_Comm) ((void *) &(ompi_mpi_comm_world))));
-
-
-
-
-
-
-
-            if (rank == 0)
-                {
-
-
-                    char * s = malloc(50 * sizeof(char));
-# 453 "mpi_skeleton.c"
-                    fprint2d(s, U, global[0], global[1]);
-                    free(s);
-
-
-                }
-            MPI_Finalize();
-            return 0;
-
-        }
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include "utils.h"
+#include "halo.h"
+#include "stencil.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+double max ( double a, double b )
+{
+    return ( a > b ) ? a : b;
+}
+
+//Row stride (in doubles) for a row of dimY elements, rounded up so that
+//consecutive rows keep the GRID_ALIGN alignment of the first one
+int grid_stride ( int dimY )
+{
+    int lanes = GRID_ALIGN / sizeof ( double );
+    return ( ( dimY + lanes - 1 ) / lanes ) * lanes;
+}
+
+int converge ( grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max )
+{
+    int i, j;
+    for ( i = X_min; i < X_max; i++ )
+        for ( j = Y_min; j < Y_max; j++ )
+            if ( fabs ( G ( u_current, i, j ) - G ( u_previous, i, j ) ) > e )
+                return 0;
+    return 1;
+}
+
+grid2d * allocate2d ( int X, int Y, int ghost )
+{
+    int lanes = GRID_ALIGN / sizeof ( double );
+    int shift = ( lanes - ghost % lanes ) % lanes; //puts column ghost on an aligned address
+    grid2d * array = ( grid2d * ) malloc ( sizeof ( grid2d ) );
+    if ( array == NULL )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+
+    array->X = X;
+    array->Y = Y;
+    array->ghost = ghost;
+    array->dimX = X + 2 * ghost;
+    array->dimY = Y + 2 * ghost;
+    array->stride = grid_stride ( array->dimY + shift );
+
+    if ( posix_memalign ( ( void ** ) &array->base, GRID_ALIGN, ( ( size_t ) array->dimX * array->stride ) * sizeof ( double ) ) != 0 )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+    array->data = array->base + shift;
+    zero2d ( array );
+    return array;
+}
+
+//Dirichlet problem: first row and first column held at val, the rest at 0
+//This fills the interior of the block whose first interior point is global
+//point (row, col): every process its own, and in hybrid mode every thread
+//its rows. The global boundary lies in the interior of the blocks along it;
+//the ghost cells keep the zeros of allocate2d until the first halo exchange
+void init_block2d ( grid2d * array, int row, int col )
+{
+    int i, j;
+#   pragma omp parallel for private(j) schedule(static)
+    for ( i = 0; i < array->X; i++ )
+        for ( j = 0; j < array->Y; j++ )
+            G ( array, array->ghost + i, array->ghost + j ) = ( row + i == 0 || col + j == 0 ) ? val : 0.0;
+}
+
+//Rows are first touched by the thread that sweeps them, so in hybrid mode
+//each thread's band of the grid lands on its own NUMA node
+void zero2d ( grid2d * array )
+{
+    int i;
+#   pragma omp parallel for schedule(static)
+    for ( i = 0; i < array->dimX; i++ )
+        memset ( array->base + ( size_t ) i * array->stride, 0, array->stride * sizeof ( double ) );
+}
+
+//dst and src must have the same dimensions and ghost width
+void copy2d ( grid2d * dst, grid2d * src )
+{
+    memcpy ( dst->base, src->base, ( ( size_t ) src->dimX * src->stride ) * sizeof ( double ) );
+}
+
+void print2d ( grid2d * array, int X, int Y )
+{
+    int i, j;
+    for ( i = 0; i < X; i++ )
+        {
+            for ( j = 0; j < Y; j++ )
+                printf ( "%lf ", G ( array, i, j ) );
+            printf ( "\n" );
+        }
+}
+
+void fprint2d ( char * s, grid2d * array, int X, int Y )
+{
+    int i, j;
+    FILE * f = fopen ( s, "w" );
+    if ( f == NULL )
+        {
+            fprintf ( stderr, "Cannot open %s\n", s );
+            return;
+        }
+    for ( i = 0; i < X; i++ )
+        {
+            for ( j = 0; j < Y; j++ )
+                fprintf ( f, "%lf ", G ( array, i, j ) );
+            fprintf ( f, "\n" );
+        }
+    fclose ( f );
+}
+
+void free2d ( grid2d * array )
+{
+    free ( array->base );
+    free ( array );
+}
+
+//Single-precision field with the layout of like: point (i, j) has the index of
+//G ( like, i, j ), so a sweep reads both through the same k
+float * allocate_field ( const grid2d * like )
+{
+    float * base;
+    if ( posix_memalign ( ( void ** ) &base, GRID_ALIGN, ( ( size_t ) like->dimX * like->stride ) * sizeof ( float ) ) != 0 )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+    memset ( base, 0, ( ( size_t ) like->dimX * like->stride ) * sizeof ( float ) );
+    return base + ( like->data - like->base );
+}
+
+void free_field ( float * field, const grid2d * like )
+{
+    free ( field - ( like->data - like->base ) );
+}
+
+grid3d * allocate3d ( int X, int Y, int Z, int ghost )
+{
+    int i;
+    int lanes = GRID_ALIGN / sizeof ( double );
+    int shift = ( lanes - ghost % lanes ) % lanes; //puts column ghost on an aligned address
+    grid3d * array = ( grid3d * ) malloc ( sizeof ( grid3d ) );
+    if ( array == NULL )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+
+    array->X = X;
+    array->Y = Y;
+    array->Z = Z;
+    array->ghost = ghost;
+    array->dimX = X + 2 * ghost;
+    array->dimY = Y + 2 * ghost;
+    array->dimZ = Z + 2 * ghost;
+    array->stride = grid_stride ( array->dimZ + shift );
+    array->plane = ( size_t ) array->dimY * array->stride;
+
+    if ( posix_memalign ( ( void ** ) &array->base, GRID_ALIGN, ( array->dimX * array->plane ) * sizeof ( double ) ) != 0 )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+    array->data = array->base + shift;
+    //First touch by the thread that sweeps the plane, as in zero2d
+#   pragma omp parallel for schedule(static)
+    for ( i = 0; i < array->dimX; i++ )
+        memset ( array->base + i * array->plane, 0, array->plane * sizeof ( double ) );
+    return array;
+}
+
+//Dirichlet problem: the first plane of every dimension held at val, the rest at 0
+//for the interior of the block whose first interior point is global point
+//(row, col, depth); the ghost cells keep the zeros of allocate3d
+void init_block3d ( grid3d * array, int row, int col, int depth )
+{
+    int i, j, l, g = array->ghost;
+#   pragma omp parallel for private(j, l) schedule(static)
+    for ( i = 0; i < array->X; i++ )
+        for ( j = 0; j < array->Y; j++ )
+            for ( l = 0; l < array->Z; l++ )
+                G3 ( array, g + i, g + j, g + l ) = ( row + i == 0 || col + j == 0 || depth + l == 0 ) ? val : 0.0;
+}
+
+//One plane after the other, separated by a blank line
+void fprint3d ( char * s, grid3d * array, int X, int Y, int Z )
+{
+    int i, j, l;
+    FILE * f = fopen ( s, "w" );
+    if ( f == NULL )
+        {
+            fprintf ( stderr, "Cannot open %s\n", s );
+            return;
+        }
+    for ( i = 0; i < X; i++ )
+        {
+            for ( j = 0; j < Y; j++ )
+                {
+                    for ( l = 0; l < Z; l++ )
+                        fprintf ( f, "%lf ", G3 ( array, i, j, l ) );
+                    fprintf ( f, "\n" );
+                }
+            fprintf ( f, "\n" );
+        }
+    fclose ( f );
+}
+
+void free3d ( grid3d * array )
+{
+    free ( array->base );
+    free ( array );
+}
+
+rbgrid2d * allocate_rb ( int X, int Y, int ghost, int shift )
+{
+    rbgrid2d * rb = ( rbgrid2d * ) malloc ( sizeof ( rbgrid2d ) );
+    if ( rb == NULL )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+    rb->dimX = X + 2 * ghost;
+    rb->dimY = Y + 2 * ghost;
+    rb->shift = shift & 1;
+    rb->red = allocate2d ( rb->dimX, ( rb->dimY + 1 ) / 2, 0 );
+    rb->black = allocate2d ( rb->dimX, ( rb->dimY + 1 ) / 2, 0 );
+    return rb;
+}
+
+void split_rb ( grid2d * array, rbgrid2d * rb )
+{
+    int i, j;
+    for ( i = 0; i < rb->dimX; i++ )
+        for ( j = 0; j < rb->dimY; j++ )
+            {
+                if ( ( i + j + rb->shift ) & 1 )
+                    G ( rb->black, i, j / 2 ) = G ( array, i, j );
+                else
+                    G ( rb->red, i, j / 2 ) = G ( array, i, j );
+            }
+}
+
+void merge_rb ( rbgrid2d * rb, grid2d * array )
+{
+    int i, j;
+    for ( i = 0; i < rb->dimX; i++ )
+        for ( j = 0; j < rb->dimY; j++ )
+            G ( array, i, j ) = ( ( i + j + rb->shift ) & 1 ) ? G ( rb->black, i, j / 2 ) : G ( rb->red, i, j / 2 );
+}
+
+void copy_rb ( rbgrid2d * dst, rbgrid2d * src )
+{
+    copy2d ( dst->red, src->red );
+    copy2d ( dst->black, src->black );
+}
+
+void free_rb ( rbgrid2d * rb )
+{
+    free2d ( rb->red );
+    free2d ( rb->black );
+    free ( rb );
+}
+
+rbgrid3d * allocate_rb3d ( int X, int Y, int Z, int ghost, int shift )
+{
+    rbgrid3d * rb = ( rbgrid3d * ) malloc ( sizeof ( rbgrid3d ) );
+    if ( rb == NULL )
+        {
+            fprintf ( stderr, "Out of memory\n" );
+            exit ( -1 );
+        }
+    rb->dimX = X + 2 * ghost;
+    rb->dimY = Y + 2 * ghost;
+    rb->dimZ = Z + 2 * ghost;
+    rb->shift = shift & 1;
+    rb->red = allocate3d ( rb->dimX, rb->dimY, ( rb->dimZ + 1 ) / 2, 0 );
+    rb->black = allocate3d ( rb->dimX, rb->dimY, ( rb->dimZ + 1 ) / 2, 0 );
+    return rb;
+}
+
+void split_rb3d ( grid3d * array, rbgrid3d * rb )
+{
+    int i, j, l;
+    for ( i = 0; i < rb->dimX; i++ )
+        for ( j = 0; j < rb->dimY; j++ )
+            for ( l = 0; l < rb->dimZ; l++ )
+                {
+                    if ( ( i + j + l + rb->shift ) & 1 )
+                        G3 ( rb->black, i, j, l / 2 ) = G3 ( array, i, j, l );
+                    else
+                        G3 ( rb->red, i, j, l / 2 ) = G3 ( array, i, j, l );
+                }
+}
+
+void merge_rb3d ( rbgrid3d * rb, grid3d * array )
+{
+    int i, j, l;
+    for ( i = 0; i < rb->dimX; i++ )
+        for ( j = 0; j < rb->dimY; j++ )
+            for ( l = 0; l < rb->dimZ; l++ )
+                G3 ( array, i, j, l ) = ( ( i + j + l + rb->shift ) & 1 ) ? G3 ( rb->black, i, j, l / 2 ) : G3 ( rb->red, i, j, l / 2 );
+}
+
+void free_rb3d ( rbgrid3d * rb )
+{
+    free3d ( rb->red );
+    free3d ( rb->black );
+    free ( rb );
+}
+
+//Contiguous band [lo, hi) of the rows [X_min, X_max) owned by the calling
+//thread of an OpenMP team, the whole range outside a parallel region
+void thread_rows ( int X_min, int X_max, int * lo, int * hi )
+{
+#   ifdef _OPENMP
+    int n = omp_get_num_threads ( ), id = omp_get_thread_num ( );
+    *lo = X_min + ( int ) ( ( long ) ( X_max - X_min ) * id / n );
+    *hi = X_min + ( int ) ( ( long ) ( X_max - X_min ) * ( id + 1 ) / n );
+#   else
+    *lo = X_min;
+    *hi = X_max;
+#   endif
+}
+
+//Value of an optional name=value argument following the positional ones
+int option_int ( int argc, char ** argv, const char * name, int def )
+{
+    int i;
+    size_t len = strlen ( name );
+    for ( i = 5; i < argc; i++ )
+        if ( strncmp ( argv[i], name, len ) == 0 && argv[i][len] == '=' )
+            return atoi ( argv[i] + len + 1 );
+    return def;
+}
+
+const char * option_str ( int argc, char ** argv, const char * name, const char * def )
+{
+    int i;
+    size_t len = strlen ( name );
+    for ( i = 5; i < argc; i++ )
+        if ( strncmp ( argv[i], name, len ) == 0 && argv[i][len] == '=' )
+            return argv[i] + len + 1;
+    return def;
+}
+
+void sched_init ( conv_sched * c, int every, int min, int max )
+{
+    c->every = every;
+    c->min = ( min < 1 ) ? 1 : min;
+    c->max = ( max < c->min ) ? c->min : max;
+    c->next = every ? 0 : c->min;
+    c->last = -1;
+    c->last_res = 0;
+    c->rate = 0;
+    c->checks = 0;
+    c->wasted = 0;
+    c->omega = 0;
+    c->power = 1;
+    c->since = -1;
+    c->settled = 1;
+    c->refined = 0;
+}
+
+//Refine the SOR factor omega from the decay seen between tests, raised to power
+void sched_omega ( conv_sched * c, double omega, int power )
+{
+    c->omega = omega;
+    c->power = power;
+    c->settled = 0;
+}
+
+int sched_due ( conv_sched * c, int t )
+{
+    return t >= c->next;
+}
+
+//A test was started at iteration t, an adaptive schedule waits for its answer
+void sched_start ( conv_sched * c, int t )
+{
+    c->checks++;
+    c->next = c->every ? ( t / c->every + 1 ) * c->every : INT_MAX;
+}
+
+//The test started at iteration t answered with the global update norm res
+void sched_update ( conv_sched * c, int t, double res )
+{
+    double gap, w;
+
+    if ( c->last >= 0 && res > 0 && res < c->last_res )
+        c->rate = log ( res / c->last_res ) / ( t - c->last );
+
+    //Only a decay measured entirely under the current omega says anything about it
+    if ( c->omega > 0 && c->last > c->since && res > 0 && res < c->last_res )
+        {
+            w = sor_refine ( c->omega, c->power * c->rate );
+            c->settled = ( w <= c->omega );
+            if ( !c->settled )
+                {
+                    c->omega = w;
+                    c->since = t;
+                    c->refined++;
+                }
+        }
+
+    //Converged: estimate how far back the norm crossed e
+    if ( res <= e )
+        {
+            if ( c->rate < 0 && res > 0 )
+                {
+                    gap = log ( res / e ) / c->rate;
+                    c->wasted = ( c->last >= 0 && gap > t - c->last ) ? t - c->last : ( int ) gap;
+                }
+        }
+    else if ( !c->every )
+        {
+            if ( c->rate < 0 )
+                gap = ceil ( log ( e / res ) / c->rate );
+            else
+                gap = ( c->last >= 0 ) ? 2.0 * ( t - c->last ) : c->min;
+            if ( gap < c->min )
+                gap = c->min;
+            if ( gap > c->max )
+                gap = c->max;
+            //Until omega settles, test at least every C iterations
+            if ( !c->settled && gap > C && C >= c->min )
+                gap = C;
+            c->next = t + ( int ) gap;
+        }
+    c->last = t;
+    c->last_res = res;
+}
+
+//Optimal SOR factor for a Jacobi iteration of spectral radius mu (Young)
+double sor_omega ( double mu )
+{
+    if ( mu >= 1 )
+        mu = 1 - e;
+    return 2.0 / ( 1 + sqrt ( 1 - mu * mu ) );
+}
+
+//Jacobi spectral radius from the squared global 2-norms of n successive
+//Jacobi iterates of the homogeneous problem: v[k + 1] = J v[k] and J is
+//symmetric, so |v[k + 1]|^2 / |v[k]|^2 is the Rayleigh quotient of J^2 at v[k],
+//which tends to mu^2 from below. Aitken's extrapolation of the last three
+//ratios is used when it lands between the last ratio and 1
+double sor_estimate ( const double * norms, int n )
+{
+    double r0, r1, r2, d, mu2;
+    if ( n < 2 || norms[n - 2] <= 0 )
+        return 0;
+    mu2 = r2 = norms[n - 1] / norms[n - 2];
+    if ( n >= 4 && norms[n - 3] > 0 && norms[n - 4] > 0 )
+        {
+            r1 = norms[n - 2] / norms[n - 3];
+            r0 = norms[n - 3] / norms[n - 4];
+            d = ( r2 - r1 ) - ( r1 - r0 );
+            if ( d < 0 && r2 - ( r2 - r1 ) * ( r2 - r1 ) / d < 1 )
+                mu2 = r2 - ( r2 - r1 ) * ( r2 - r1 ) / d;
+        }
+    return sqrt ( mu2 );
+}
+
+//Spectral radius of the Jacobi iteration from sweeps Jacobi sweeps of the
+//homogeneous problem of st (the 5-point Laplacian if NULL), starting from 1 on
+//every interior point of the X x Y blocks of comm: mostly the smoothest mode,
+//so the ratio of the update norms settles quickly. nbr picks the halo backend
+double jacobi_radius ( MPI_Comm comm, int nbr, int sweeps, int X, int Y, int north, int south, int east, int west, int i_min, int i_max, int j_min, int j_max, const stencil2d * st )
+{
+    int i, j, k;
+    double r, mu;
+    double * norms = ( double * ) malloc ( sweeps * sizeof ( double ) );
+    double * sums = ( double * ) malloc ( sweeps * sizeof ( double ) );
+    grid2d * v[2];
+    halo2d h[2];
+    MPI_Datatype row, column, dummy;
+
+    v[0] = allocate2d ( X, Y, 1 );
+    v[1] = allocate2d ( X, Y, 1 );
+    MPI_Type_contiguous ( Y, MPI_DOUBLE, &row );
+    MPI_Type_commit ( &row );
+    //Columns span the ghost rows too, to carry the corners after the rows
+    MPI_Type_vector ( X + 2, 1, v[0]->stride, MPI_DOUBLE, &dummy );
+    MPI_Type_create_resized ( dummy, 0, sizeof ( double ), &column );
+    MPI_Type_commit ( &column );
+    for ( k = 0; k < 2; k++ )
+        {
+            halo_init ( &h[k], comm, nbr );
+            halo_side ( &h[k], HALO_NORTH, &G ( v[k], 1, 1 ), &G ( v[k], 0, 1 ), row, north );
+            halo_side ( &h[k], HALO_SOUTH, &G ( v[k], X, 1 ), &G ( v[k], X + 1, 1 ), row, south );
+            if ( st != NULL && st->corners )
+                halo_phase ( &h[k] );
+            halo_side ( &h[k], HALO_WEST, &G ( v[k], 0, 1 ), &G ( v[k], 0, 0 ), column, west );
+            halo_side ( &h[k], HALO_EAST, &G ( v[k], 0, Y ), &G ( v[k], 0, Y + 1 ), column, east );
+        }
+    for ( i = i_min; i < i_max; i++ )
+        for ( j = j_min; j < j_max; j++ )
+            G ( v[0], i, j ) = 1;
+
+    for ( k = 0; k < sweeps; k++ )
+        {
+            grid2d * p = v[k & 1], * c = v[( k + 1 ) & 1];
+            halo_exchange ( &h[k & 1] );
+            r = 0;
+#           pragma omp parallel for private(j) reduction(+:r) schedule(static)
+            for ( i = i_min; i < i_max; i++ )
+                for ( j = j_min; j < j_max; j++ )
+                    {
+                        size_t q = ( size_t ) i * p->stride + j;
+                        G ( c, i, j ) = ( st != NULL ) ? stencil_eval ( st, p->data, p->data, p->stride, q ) : STENCIL5 ( p->data, p->data, p->stride, q );
+                        r += G ( c, i, j ) * G ( c, i, j );
+                    }
+            norms[k] = r;
+        }
+    MPI_Allreduce ( norms, sums, sweeps, MPI_DOUBLE, MPI_SUM, comm );
+    mu = sor_estimate ( sums, sweeps );
+
+    for ( k = 0; k < 2; k++ )
+        {
+            halo_free ( &h[k] );
+            free2d ( v[k] );
+        }
+    MPI_Type_free ( &row );
+    MPI_Type_free ( &column );
+    free ( norms );
+    free ( sums );
+    return mu;
+}
+
+//Adaptive SOR (Hageman and Young): below the optimum factor the update norm
+//decays by lambda = exp ( rate ) per iteration, with
+//mu^2 = ( lambda + omega - 1 )^2 / ( lambda omega^2 ). Returns the optimum for
+//that mu when it is larger than omega, omega otherwise
+//Close to the optimum the norm decays slower than lambda for a while and mu
+//comes out too large, so omega is kept once lambda is below (omega - 1)^SOR_F
+double sor_refine ( double omega, double rate )
+{
+    double lambda = exp ( rate ), mu2;
+    if ( rate >= 0 || lambda <= pow ( omega - 1, SOR_F ) )
+        return omega;
+    mu2 = ( lambda + omega - 1 ) * ( lambda + omega - 1 ) / ( lambda * omega * omega );
+    if ( mu2 >= 1 )
+        return omega;
+    return max ( omega, sor_omega ( sqrt ( mu2 ) ) );
+}
+
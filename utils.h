@@ -1,14 +1,123 @@
-#define C 100
+#include <mpi.h>
+
+#define C 100 //fixed convergence test interval, adaptive tests default to C / 10 to 10 C apart
 #define T 100000000
 
 #define val 1.0
 #define e 0.000001
 
+#define SOR_F 0.75 //adaptive SOR keeps omega once the decay is within this power of omega - 1
+
+#define GRID_ALIGN 64 //alignment of every grid allocation in bytes
+
+//Contiguous 2D grid: a single aligned allocation with a padded row stride
+//Element (i, j) lives at data[i * stride + j], ghost layers included, so
+//the interior starts at (ghost, ghost) and every interior row is aligned
+typedef struct
+{
+    double * base;  //start of the allocation, only used to free it
+    double * data;  //element (0, 0)
+    int X, Y;       //interior dimensions
+    int dimX, dimY; //dimensions including ghost layers
+    int ghost;      //ghost layer width on each side
+    int stride;     //row stride in doubles (dimY rounded up to GRID_ALIGN)
+} grid2d;
+
+#define G(g, i, j) ((g)->data[(size_t)(i) * (g)->stride + (j)])
+
+//Contiguous 3D grid, the same layout plane by plane: element (i, j, l) lives
+//at data[i * plane + j * stride + l], so l is the unit-stride dimension
+typedef struct
+{
+    double * base;        //start of the allocation, only used to free it
+    double * data;        //element (0, 0, 0)
+    int X, Y, Z;          //interior dimensions
+    int dimX, dimY, dimZ; //dimensions including ghost layers
+    int ghost;            //ghost layer width on each side
+    int stride;           //row stride in doubles (dimZ rounded up to GRID_ALIGN)
+    size_t plane;         //plane stride in doubles, dimY rows
+} grid3d;
+
+#define G3(g, i, j, l) ((g)->data[(size_t)(i) * (g)->plane + (size_t)(j) * (g)->stride + (l)])
+
+//Split checkerboard: red and black points of a grid in two compressed planes
+//Point (i, j) is red if (i + j + shift) is even and lives at column j / 2 of
+//its colour plane, so every row of a plane holds a single colour contiguously
+typedef struct
+{
+    grid2d * red, * black; //colour planes, dimX rows of (dimY + 1) / 2 points
+    int dimX, dimY;        //dimensions of the full grid including ghost layers
+    int shift;             //parity of the global index of local point (0, 0)
+} rbgrid2d;
+
+//The same split of a 3D grid: point (i, j, l) is red if (i + j + l + shift)
+//is even and lives at column l / 2 of its colour grid
+typedef struct
+{
+    grid3d * red, * black; //colour grids, dimX planes of dimY rows of (dimZ + 1) / 2 points
+    int dimX, dimY, dimZ;  //dimensions of the full grid including ghost layers
+    int shift;             //parity of the global index of local point (0, 0, 0)
+} rbgrid3d;
+
+//Convergence test schedule: every fixed iterations, or adaptive (every == 0):
+//the next test goes where the decay rate of the update norm between the last
+//two tests predicts it reaches e, at least min and at most max iterations on
+//It can also refine an SOR factor from that decay (sched_omega), testing every
+//min iterations until the factor settles; an iteration that decays as the
+//power-th root of SOR under that factor (Chebyshev: 2) is refined the same way
+typedef struct
+{
+    int every;       //fixed interval, 0 for adaptive
+    int min, max;    //bounds on an adaptive interval
+    int next;        //iteration of the next test
+    int last;        //iteration of the last answered test, -1 before the first
+    double last_res; //its update norm
+    double rate;     //log of the decay per iteration, 0 while unknown
+    int checks;      //tests started
+    int wasted;      //estimated iterations between reaching e and the test that saw it
+    double omega;    //SOR factor refined from the decay between tests, 0 if not refining
+    int power;       //SOR decays as this power of the decay of the iteration
+    int since;       //test iteration at which omega last changed
+    int settled;     //the last usable decay did not raise omega
+    int refined;     //times omega changed
+} conv_sched;
+
+struct stencil2d; //stencil.h
+
 double max ( double a, double b );
-int converge ( double ** u_previous, double ** u_current, int X, int Y );
-double ** allocate2d ( int dimX, int dimY );
-void init2d ( double ** array, int dimX, int dimY );
-void zero2d ( double ** array, int dimX, int dimY );
-void print2d ( double ** array, int dimX, int dimY );
-void fprint2d ( char * s, double ** array, int dimX, int dimY );
-void free2d ( double ** array, int dimX, int dimY );
\ No newline at end of file
+int grid_stride ( int dimY );
+int converge ( grid2d * u_previous, grid2d * u_current, int X_min, int X_max, int Y_min, int Y_max );
+grid2d * allocate2d ( int X, int Y, int ghost );
+void init_block2d ( grid2d * array, int row, int col );
+void zero2d ( grid2d * array );
+void print2d ( grid2d * array, int X, int Y );
+void fprint2d ( char * s, grid2d * array, int X, int Y );
+void free2d ( grid2d * array );
+float * allocate_field ( const grid2d * like );
+grid3d * allocate3d ( int X, int Y, int Z, int ghost );
+void init_block3d ( grid3d * array, int row, int col, int depth );
+void fprint3d ( char * s, grid3d * array, int X, int Y, int Z );
+void free3d ( grid3d * array );
+rbgrid3d * allocate_rb3d ( int X, int Y, int Z, int ghost, int shift );
+void split_rb3d ( grid3d * array, rbgrid3d * rb );
+void merge_rb3d ( rbgrid3d * rb, grid3d * array );
+void free_rb3d ( rbgrid3d * rb );
+void free_field ( float * field, const grid2d * like );
+rbgrid2d * allocate_rb ( int X, int Y, int ghost, int shift );
+void split_rb ( grid2d * array, rbgrid2d * rb );
+void merge_rb ( rbgrid2d * rb, grid2d * array );
+void copy_rb ( rbgrid2d * dst, rbgrid2d * src );
+void free_rb ( rbgrid2d * rb );
+void thread_rows ( int X_min, int X_max, int * lo, int * hi );
+int option_int ( int argc, char ** argv, const char * name, int def );
+const char * option_str ( int argc, char ** argv, const char * name, const char * def );
+void copy2d ( grid2d * dst, grid2d * src );
+void sched_init ( conv_sched * c, int every, int min, int max );
+int sched_due ( conv_sched * c, int t );
+void sched_omega ( conv_sched * c, double omega, int power );
+void sched_start ( conv_sched * c, int t );
+void sched_update ( conv_sched * c, int t, double res );
+double sor_omega ( double mu );
+double sor_estimate ( const double * norms, int n );
+double jacobi_radius ( MPI_Comm comm, int nbr, int sweeps, int X, int Y, int north, int south, int east, int west, int i_min, int i_max, int j_min, int j_max, const struct stencil2d * st );
+double sor_refine ( double omega, double rate );